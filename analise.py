@@ -1,247 +1,339 @@
-import subprocess
-import time
-import pandas as pd
-import matplotlib.pyplot as plt
-import seaborn as sns
-import os
+"""Harness de desempenho e escalabilidade do simulador (TPEXTRA).
+
+Gera entradas com o genwkl3 (ciclos de vida completos, já em ordem de tempo)
+e varre, uma de cada vez, a quantidade de eventos, de clientes, de armazéns e
+o mix de consultas, mantendo as outras dimensões na configuração base. Cada
+configuração roda algumas vezes de aquecimento (descartadas) e depois as
+repetições medidas; guarda a mediana do tempo de parede, o pico de memória
+(RSS), eventos/s e consultas/s.
+
+Duas verificações fazem o programa sair com código 1:
+  - regressão: com --baseline, o melhor tempo ou o pico de RSS de alguma
+    configuração piorou mais que --limite em relação ao arquivo de referência
+    (gravado antes com --gravar-baseline). Uma referência gravada com outro
+    --rapido, --args-simulador, --seed ou configuração base é recusada antes
+    de medir (código 2);
+  - escala: na varredura de eventos, o tempo cresceu mais rápido que
+    eventos^--expoente-maximo entre dois pontos seguidos (por exemplo, uma
+    inserção quadrática escondida num caminho quente).
+
+Exemplos:
+    python3 analise.py --rapido --gravar-baseline baseline.json
+    python3 analise.py --rapido --baseline baseline.json --limite 0.25
+"""
+import argparse
 import glob
+import json
+import math
+import os
+import statistics
+import subprocess
 import sys
-import numpy as np
+import tempfile
+import time
+
+# Fontes do gerador e do simulador, relativas a este arquivo
+RAIZ = os.path.dirname(os.path.abspath(__file__))
+
+# Configuração base; cada varredura muda só uma dimensão
+BASE = {"pacotes": 20000, "clientes": 1000, "armazens": 50, "mix": "10:10:5:5", "consultas": 20}
 
-def compile_code():
-    """Compila o simulador C++ e o gerador de dados C."""
-    print("\n[🛠] Iniciando compilação do código-fonte para TPEXTRA...")
-    start_time = time.time()
-    
+VARREDURAS = {
+    "eventos": ("pacotes", [2000, 20000, 100000, 400000]),
+    "clientes": ("clientes", [10, 100, 1000, 10000, 100000]),
+    "armazens": ("armazens", [10, 50, 200, 1000]),
+    "mix": ("mix", ["1:0:0:0", "0:1:0:0", "0:0:1:0", "0:0:0:1", "10:10:5:5"]),
+}
+
+# Valores menores para rodar em poucos segundos (integração contínua)
+VARREDURAS_RAPIDAS = {
+    "eventos": ("pacotes", [1000, 5000, 25000]),
+    "clientes": ("clientes", [10, 1000, 10000]),
+    "armazens": ("armazens", [10, 100, 500]),
+    "mix": ("mix", ["1:0:0:0", "0:1:0:0", "0:0:1:0", "0:0:0:1"]),
+}
+BASE_RAPIDA = dict(BASE, pacotes=5000)
+
+# Métricas comparadas com a baseline. Para a mesma entrada, eventos/s e
+# consultas/s só dependem do tempo; o tempo usado é o melhor das repetições,
+# que varia bem menos que a mediana entre duas execuções do harness.
+METRICAS = ("tempo_min_s", "rss_kb")
+
+
+def compile_code(pasta, compilar_simulador=True):
+    """Compila o gerador de dados C e, se pedido, o simulador C++ (otimizado) em pasta."""
+    print("\n[🛠] Compilando o gerador" + (" e o simulador..." if compilar_simulador else "..."))
+    inicio = time.time()
+    gerador = os.path.join(pasta, "genwkl3")
+    simulador = os.path.join(pasta, "simulador") if compilar_simulador else None
     try:
-        # Compila o gerador de dados
-        print("  - Compilando o gerador de dados (genwkl3)...")
-        gen_path = "genwkl3.c"
-        if not os.path.exists(gen_path):
-            raise FileNotFoundError("Arquivo 'genwkl3.c' não encontrado.")
-        
-        result = subprocess.run(
-            ["gcc", "-O2", "-o", "genwkl3", gen_path, "-lm"],
-            check=True, capture_output=True, text=True
-        )
-        if result.stderr:
-            print(f"    ⚠️ Avisos na compilação do genwkl3:\n{result.stderr}")
-
-        # Compila o simulador C++
-        print("  - Compilando o simulador C++ (TPEXTRA)...")
-        source_files = glob.glob("src/*.cc")
-        if not source_files:
+        subprocess.run(["gcc", "-O2", "-o", gerador, os.path.join(RAIZ, "genwkl3.c"), "-lm"],
+                       check=True, capture_output=True, text=True)
+        if not compilar_simulador:
+            print(f"==> ✅ Compilação concluída em {time.time() - inicio:.2f} segundos.")
+            return gerador, simulador
+        fontes = sorted(glob.glob(os.path.join(RAIZ, "src", "*.cc")))
+        if not fontes:
             raise FileNotFoundError("Nenhum arquivo .cc encontrado em src/")
-        
-        command = [
-            "g++", "-std=c++11", "-O2", "-Wall",
-            "-I./include",
-            "-o", "simulador"
-        ] + source_files
-        result = subprocess.run(command, check=True, capture_output=True, text=True)
-        if result.stderr:
-            print(f"    ⚠️ Avisos na compilação do simulador:\n{result.stderr}")
-
-        compile_time = time.time() - start_time
-        print(f"==> ✅ Compilação bem-sucedida em {compile_time:.2f} segundos.")
-        return True
-
+        subprocess.run(["g++", "-std=c++11", "-O2", "-Wall", "-pthread", "-I" + os.path.join(RAIZ, "include"), "-o", simulador] + fontes,
+                       check=True, capture_output=True, text=True)
     except (FileNotFoundError, subprocess.CalledProcessError) as e:
         print("❌ ERRO durante a compilação:")
-        if hasattr(e, 'stderr'): print(e.stderr)
-        else: print(e)
-        sys.exit(1)
+        print(getattr(e, "stderr", None) or e)
+        sys.exit(2)
+    print(f"==> ✅ Compilação concluída em {time.time() - inicio:.2f} segundos.")
+    return gerador, simulador
 
 
-def generate_input_file(nodes, packets, clients, seed):
-    """Executa o gerador de dados para criar 'tp3.in' e ordena o arquivo."""
-    try:
-        # Executa o gerador que cria 'tp3.in'
-        subprocess.run(
-            ["./genwkl3", "-s", str(seed), "-n", str(nodes), "-p", str(packets), "-c", str(clients), "-t", "10"],
-            check=True, capture_output=True, text=True
-        )
-        
-        # Ordena o arquivo de entrada, que é crucial para o processamento sequencial de tempo
-        if os.path.exists("tp3.in"):
-            with open("tp3.in", "r") as f:
-                content = f.readlines()
-            
-            content.sort() # Ordena as linhas (eventos e consultas) por timestamp
-            
-            with open("tp3.in", "w") as f:
-                f.writelines(content)
-        else:
-            raise FileNotFoundError("tp3.in não foi gerado.")
-        return True
-    except (subprocess.CalledProcessError, FileNotFoundError) as e:
-        print(f"❌ ERRO ao gerar arquivo de entrada: {e}")
-        if hasattr(e, 'stderr'): print(e.stderr)
-        return False
-
-
-def run_simulation(input_file):
-    """Executa uma simulação e retorna as métricas de desempenho."""
-    if not (os.path.exists("./simulador") and os.path.exists(input_file)):
-        return None
+def generate_input_file(gerador, arquivo, config, seed):
+    """Gera a entrada da configuração e conta eventos e consultas."""
+    subprocess.run([gerador, "-s", str(seed), "-n", str(config["armazens"]), "-p", str(config["pacotes"]),
+                    "-c", str(config["clientes"]), "-m", config["mix"], "-q", str(config["consultas"]),
+                    "-o", arquivo], check=True, capture_output=True, text=True)
+    eventos = consultas = 0
+    with open(arquivo, "rb") as f:
+        for linha in f:
+            if b" EV " in linha:
+                eventos += 1
+            else:
+                consultas += 1
+    return eventos, consultas
+
+
+def run_simulation(simulador, argumentos, arquivo):
+    """Roda o simulador uma vez; retorna (segundos, pico de RSS em KB)."""
+    with open(os.devnull, "wb") as nulo:
+        inicio = time.perf_counter()
+        processo = subprocess.Popen([simulador] + argumentos + [arquivo], stdout=nulo, stderr=subprocess.PIPE)
+        # wait4 devolve o uso de recursos só deste filho
+        _, status, uso = os.wait4(processo.pid, 0)
+        segundos = time.perf_counter() - inicio
+        erros = processo.stderr.read().decode("utf-8", "replace")
+        processo.stderr.close()
+    if status != 0:
+        raise RuntimeError(f"simulador terminou com status {status}: {erros.strip()[:500]}")
+    return segundos, uso.ru_maxrss
+
+
+def measure(simulador, argumentos, arquivo, aquecimento, repeticoes):
+    """Aquecimento descartado e depois as repetições medidas."""
+    for _ in range(aquecimento):
+        run_simulation(simulador, argumentos, arquivo)
+    tempos, picos = [], []
+    for _ in range(repeticoes):
+        segundos, rss = run_simulation(simulador, argumentos, arquivo)
+        tempos.append(segundos)
+        picos.append(rss)
+    return tempos, picos
+
+
+def run_sweeps(args, gerador, simulador, pasta):
+    varreduras = VARREDURAS_RAPIDAS if args.rapido else VARREDURAS
+    base = BASE_RAPIDA if args.rapido else BASE
+    nomes = list(varreduras) if args.varredura == "todas" else [args.varredura]
+    argumentos = args.args_simulador.split()
+    arquivo = os.path.join(pasta, "tp3.in")
+
+    resultados = []
+    for indice, nome in enumerate(nomes):
+        parametro, valores = varreduras[nome]
+        print(f"\n[ {indice + 1} ] Varredura de {nome} ({parametro})")
+        print("-" * 50)
+        for valor in valores:
+            config = dict(base, **{parametro: valor})
+            chave = f"{nome}/{parametro}={valor}"
+            # Semente fixa por configuração: a mesma entrada em todas as execuções
+            seed = args.seed + sum(ord(c) for c in chave)
+            eventos, consultas = generate_input_file(gerador, arquivo, config, seed)
+            tempos, picos = measure(simulador, argumentos, arquivo, args.aquecimento, args.repeticoes)
+            mediana = statistics.median(tempos)
+            resultado = {
+                "chave": chave, "varredura": nome, "parametro": parametro, "valor": valor,
+                "pacotes": config["pacotes"], "clientes": config["clientes"], "armazens": config["armazens"],
+                "mix": config["mix"], "eventos": eventos, "consultas": consultas,
+                "tempo_s": mediana, "tempo_min_s": min(tempos),
+                "tempo_desvio_s": statistics.stdev(tempos) if len(tempos) > 1 else 0.0,
+                "rss_kb": max(picos),
+                "eventos_s": eventos / mediana if mediana > 0 else 0.0,
+                "consultas_s": consultas / mediana if mediana > 0 else 0.0,
+            }
+            resultados.append(resultado)
+            print(f"  {chave:<28} {eventos:>9} ev {consultas:>7} cons  {mediana:8.3f} s "
+                  f"(±{resultado['tempo_desvio_s']:.3f})  {resultado['rss_kb'] / 1024:7.1f} MB  "
+                  f"{resultado['eventos_s']:12.0f} ev/s  {resultado['consultas_s']:10.0f} cons/s")
+    return resultados
+
+
+def check_scaling(resultados, expoente_maximo, tempo_minimo):
+    """Expoente aparente log(t2/t1)/log(n2/n1) entre pontos seguidos da varredura de eventos."""
+    pontos = sorted((r for r in resultados if r["varredura"] == "eventos"), key=lambda r: r["eventos"])
+    falhas = []
+    for a, b in zip(pontos, pontos[1:]):
+        if b["tempo_s"] < tempo_minimo or a["eventos"] == b["eventos"]:
+            continue # Tempos pequenos demais são dominados pela partida do processo
+        expoente = math.log(b["tempo_s"] / a["tempo_s"]) / math.log(b["eventos"] / a["eventos"])
+        situacao = "ok" if expoente <= expoente_maximo else "ACIMA DO LIMITE"
+        print(f"  {a['eventos']:>9} -> {b['eventos']:>9} eventos: expoente {expoente:5.2f} ({situacao})")
+        if expoente > expoente_maximo:
+            falhas.append(f"escala {a['chave']} -> {b['chave']}: expoente {expoente:.2f} > {expoente_maximo}")
+    return falhas
+
+
+# Campos do JSON que definem as entradas e a execução; uma baseline gravada
+# com outros valores mediu outra coisa, mesmo que as chaves coincidam
+CAMPOS_CONFIGURACAO = ("rapido", "args_simulador", "base", "seed")
+
+
+def current_config(args):
+    """Campos de CAMPOS_CONFIGURACAO para esta execução."""
+    return {"rapido": args.rapido, "args_simulador": args.args_simulador,
+            "base": BASE_RAPIDA if args.rapido else BASE, "seed": args.seed}
+
+
+def check_baseline_config(arquivo, configuracao):
+    """Lista as diferenças de configuração entre a baseline e esta execução."""
+    with open(arquivo) as f:
+        gravada = json.load(f)
+    return [f"{campo}: baseline {gravada.get(campo, '(ausente)')!r}, agora {configuracao[campo]!r}"
+            for campo in CAMPOS_CONFIGURACAO if gravada.get(campo) != configuracao[campo]]
+
+
+def compare_baseline(resultados, arquivo, limite, tempo_minimo):
+    """Compara cada métrica com a baseline; devolve a lista de regressões."""
+    with open(arquivo) as f:
+        baseline = {r["chave"]: r for r in json.load(f)["resultados"]}
+    regressoes = []
+    for r in resultados:
+        ref = baseline.get(r["chave"])
+        if ref is None:
+            print(f"  {r['chave']:<28} sem referência na baseline")
+            continue
+        # Abaixo de tempo_minimo a variação é ruído de partida, não do simulador
+        if max(r["tempo_s"], ref["tempo_s"]) < tempo_minimo:
+            continue
+        for metrica in METRICAS:
+            antes, agora = ref[metrica], r[metrica]
+            if antes <= 0:
+                continue
+            variacao = (agora - antes) / antes
+            if variacao > limite:
+                regressoes.append(f"{r['chave']}: {metrica} {antes:.4g} -> {agora:.4g} ({variacao:+.1%})")
+    return regressoes
+
+
+def plot_sweeps(resultados, prefixo):
+    """Um gráfico log-log de tempo por varredura numérica (se houver matplotlib)."""
     try:
-        start_time = time.time()
-        result = subprocess.run(
-            ["./simulador", input_file],
-            check=True, capture_output=True, text=True, encoding='utf-8'
-        )
-        exec_time = time.time() - start_time
-        output_lines = result.stdout.splitlines()
-        # Contabiliza todas as consultas, incluindo as novas
-        total_consultas = len([
-            line for line in output_lines 
-            if "CL " in line or "PC " in line or "MA " in line or "RC " in line
-        ])
-        return {"exec_time": exec_time, "total_consultas": total_consultas}
-    except subprocess.CalledProcessError as e:
-        print(f"❌ Erro na simulação: {e.stderr.strip()}")
-        return None
-
-
-def plot_2d_analysis(df, x_var, y_var, title, filename, log_scale=False, x_min=None, y_min=None):
-    """Gera um gráfico 2D focado para documentação."""
-    if df.empty:
-        print(f"⚠️ AVISO: Sem dados para plotar '{filename}'")
+        import matplotlib
+        matplotlib.use("Agg")
+        import matplotlib.pyplot as plt
+    except ImportError:
+        print("⚠️ matplotlib não encontrado; gráficos não gerados.")
         return
-        
-    plt.style.use('seaborn-v0_8-whitegrid')
-    plt.figure(figsize=(10, 6))
-    
-    if log_scale:
-        plt.xscale('log')
-        plt.yscale('log')
-    
-    sns.regplot(
-        data=df, x=x_var, y=y_var,
-        scatter=True, ci=95,
-        scatter_kws={'alpha': 0.5, 's': 50, 'color': 'darkgreen'}, # Cor alterada para diferenciar
-        line_kws={'color': 'darkred', 'linewidth': 2}
-    )
-    
-    plt.title(title, fontsize=16, fontweight='bold', pad=15)
-    plt.xlabel(x_var.replace('_', ' ').capitalize(), fontsize=12)
-    plt.ylabel(y_var.replace('_', ' ').capitalize(), fontsize=12)
-    
-    if x_min is not None:
-        plt.xlim(left=x_min)
-    if y_min is not None:
-        plt.ylim(bottom=y_min)
-    
-    plt.grid(True, which="both", ls="--", c='gray', alpha=0.5)
-    plt.tight_layout()
-    plt.savefig(filename, dpi=150, bbox_inches='tight')
-    print(f"==> 📄 Gráfico de análise salvo em '{filename}'")
-    plt.close()
+    for nome in ("eventos", "clientes", "armazens"):
+        pontos = sorted((r for r in resultados if r["varredura"] == nome), key=lambda r: r["valor"])
+        if len(pontos) < 2:
+            continue
+        x = [r["eventos"] if nome == "eventos" else r["valor"] for r in pontos]
+        plt.figure(figsize=(10, 6))
+        plt.xscale("log")
+        plt.yscale("log")
+        plt.errorbar(x, [r["tempo_s"] for r in pontos], yerr=[r["tempo_desvio_s"] for r in pontos],
+                     marker="o", color="darkgreen", ecolor="darkred", capsize=4)
+        plt.title(f"Desempenho (TPEXTRA) vs. {nome}", fontsize=16, fontweight="bold", pad=15)
+        plt.xlabel(nome.capitalize(), fontsize=12)
+        plt.ylabel("Tempo (s, mediana)", fontsize=12)
+        plt.grid(True, which="both", ls="--", c="gray", alpha=0.5)
+        plt.tight_layout()
+        arquivo = f"{prefixo}_tempo_vs_{nome}.png"
+        plt.savefig(arquivo, dpi=150, bbox_inches="tight")
+        plt.close()
+        print(f"==> 📄 Gráfico salvo em '{arquivo}'")
 
 
 def main():
-    """Orquestra a análise experimental completa."""
-    print("\n" + "="*70)
+    parser = argparse.ArgumentParser(description="Harness de escalabilidade do simulador (TPEXTRA).")
+    parser.add_argument("--varredura", choices=["todas"] + list(VARREDURAS), default="todas")
+    parser.add_argument("--rapido", action="store_true", help="configurações menores, para rodar em poucos segundos")
+    parser.add_argument("--repeticoes", type=int, default=5)
+    parser.add_argument("--aquecimento", type=int, default=1, help="execuções descartadas antes das medidas")
+    parser.add_argument("--seed", type=int, default=2024)
+    parser.add_argument("--simulador", help="binário já compilado (senão, compila src/ com -O2)")
+    parser.add_argument("--args-simulador", default="--threads 1", help="argumentos extras do simulador")
+    parser.add_argument("--saida", default="analise_resultados_tpextra", help="prefixo do .json, .csv e gráficos")
+    parser.add_argument("--baseline", help="JSON de referência para a verificação de regressão")
+    parser.add_argument("--gravar-baseline", help="grava os resultados como nova referência")
+    parser.add_argument("--limite", type=float, default=0.25, help="piora relativa tolerada (0.15 = 15%%)")
+    parser.add_argument("--tempo-minimo", type=float, default=0.1,
+                        help="configurações mais rápidas que isto (s) não entram nas verificações")
+    parser.add_argument("--expoente-maximo", type=float, default=1.5,
+                        help="crescimento tolerado do tempo na varredura de eventos (t ~ eventos^k)")
+    parser.add_argument("--sem-graficos", action="store_true")
+    args = parser.parse_args()
+    if args.repeticoes < 1 or args.aquecimento < 0:
+        parser.error("--repeticoes deve ser >= 1 e --aquecimento >= 0")
+
+    print("\n" + "=" * 70)
     print("      ANÁLISE DE DESEMPENHO E ESCALABILIDADE DO SIMULADOR (TPEXTRA)")
-    print("="*70 + "\n")
+    print("=" * 70)
 
-    if not compile_code():
-        sys.exit(1)
+    # Recusa antes de medir: comparar com outra configuração não diz nada
+    configuracao = current_config(args)
+    if args.baseline:
+        diferencas = check_baseline_config(args.baseline, configuracao)
+        if diferencas:
+            print(f"❌ ERRO: '{args.baseline}' foi gravada com outra configuração:")
+            for diferenca in diferencas:
+                print(f"  - {diferenca}")
+            sys.exit(2)
 
-    # --- Configurações do Experimento ---
-    repetitions = 5
-    rng = np.random.default_rng(seed=2024)
-    results_data = []
-
-    # --- Experimento 1: Variação de Pacotes e Clientes ---
-    print("\n[ 1 ] Análise de Escalabilidade por Carga de Trabalho")
-    print("-" * 50)
-    packets_range = [100, 500, 1000, 5000, 10000, 25000]
-    clients_range = [10, 50, 100, 250, 500, 1000]
-    
-    for packets in packets_range:
-        for clients in clients_range:
-            nodes = max(50, int(packets/100))
-            print(f"  Testando: {packets} pacotes, {clients} clientes...")
-            
-            for _ in range(repetitions):
-                seed = int(rng.integers(1, 2**30))
-                if generate_input_file(nodes=nodes, packets=packets, clients=clients, seed=seed):
-                    metrics = run_simulation("tp3.in")
-                    if metrics:
-                        results_data.append({
-                            "packets": packets,
-                            "clients": clients,
-                            "nodes": nodes,
-                            "exec_time": metrics["exec_time"],
-                        })
-
-    # --- Experimento 2: Variação de Densidade ---
-    print("\n[ 2 ] Análise de Escalabilidade por Densidade da Rede")
-    print("-" * 50)
-    densities = [0.01, 0.1, 0.5, 1.0, 2.0, 5.0, 10.0]
-    base_nodes = 100
-    
-    for density in densities:
-        clients = max(1, int(base_nodes * density))
-        packets = clients * 100
-        print(f"  Testando: Densidade {density:.2f} ({clients} clientes)...")
-        
-        for _ in range(repetitions):
-            seed = int(rng.integers(1, 2**30))
-            if generate_input_file(nodes=base_nodes, packets=packets, clients=clients, seed=seed):
-                metrics = run_simulation("tp3.in")
-                if metrics:
-                    results_data.append({
-                        "packets": packets,
-                        "clients": clients,
-                        "nodes": base_nodes,
-                        "densidade": density,
-                        "exec_time": metrics["exec_time"],
-                    })
-
-    if not results_data:
-        print("\n⚠️ Nenhum resultado de simulação foi coletado. Encerrando.")
-        return
+    with tempfile.TemporaryDirectory(prefix="analise_tp3_") as pasta:
+        gerador, simulador = compile_code(pasta, compilar_simulador=not args.simulador)
+        if args.simulador:
+            simulador = os.path.abspath(args.simulador)
+        try:
+            resultados = run_sweeps(args, gerador, simulador, pasta)
+        except (RuntimeError, subprocess.CalledProcessError) as e:
+            print(f"❌ ERRO: {getattr(e, 'stderr', None) or e}")
+            sys.exit(2)
+
+    dados = {
+        "data": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "repeticoes": args.repeticoes, "aquecimento": args.aquecimento, **configuracao,
+        "resultados": resultados,
+    }
+    if os.path.dirname(args.saida):
+        os.makedirs(os.path.dirname(args.saida), exist_ok=True)
+    with open(args.saida + ".json", "w") as f:
+        json.dump(dados, f, indent=2)
+    colunas = list(resultados[0]) if resultados else []
+    with open(args.saida + ".csv", "w") as f:
+        f.write(",".join(colunas) + "\n")
+        for r in resultados:
+            f.write(",".join(str(r[c]) for c in colunas) + "\n")
+    print(f"\n✅ Resultados salvos em '{args.saida}.json' e '{args.saida}.csv'")
+    if args.gravar_baseline:
+        with open(args.gravar_baseline, "w") as f:
+            json.dump(dados, f, indent=2)
+        print(f"==> Baseline gravada em '{args.gravar_baseline}'")
+    if not args.sem_graficos:
+        plot_sweeps(resultados, args.saida)
+
+    falhas = []
+    if any(r["varredura"] == "eventos" for r in resultados):
+        print("\n[ Escala ] Crescimento do tempo com o número de eventos")
+        falhas += check_scaling(resultados, args.expoente_maximo, args.tempo_minimo)
+    if args.baseline:
+        print(f"\n[ Regressão ] Comparação com '{args.baseline}' (limite {args.limite:.0%})")
+        falhas += compare_baseline(resultados, args.baseline, args.limite, args.tempo_minimo)
+
+    if falhas:
+        print("\n❌ FALHOU:")
+        for falha in falhas:
+            print(f"  - {falha}")
+        sys.exit(1)
+    print("\n✅ Nenhuma regressão encontrada.")
 
-    # --- Processamento e Geração de Gráficos ---
-    full_df = pd.DataFrame(results_data)
-    results_file = "analise_resultados_tpextra.csv"
-    full_df.to_csv(results_file, index=False)
-    
-    print("\n" + "="*70)
-    print(f"✅ Análise (TPEXTRA) concluída. Resultados salvos em '{results_file}'")
-    print("="*70 + "\n")
-
-    print("[ 3 ] Gerando gráficos para documentação...")
-    
-    plot_2d_analysis(
-        full_df, 
-        x_var="packets", 
-        y_var="exec_time", 
-        title="Desempenho (TPEXTRA) vs. Volume de Pacotes", 
-        filename="analise_tpextra_tempo_vs_pacotes.png",
-        log_scale=True, x_min=100, y_min=0.001
-    )
-    
-    density_df = full_df[full_df['densidade'].notna()].copy()
-    if not density_df.empty:
-        plot_2d_analysis(
-            density_df,
-            x_var="densidade",
-            y_var="exec_time",
-            title="Desempenho (TPEXTRA) vs. Densidade de Clientes",
-            filename="analise_tpextra_tempo_vs_densidade.png",
-            log_scale=True, x_min=0.01, y_min=0.001
-        )
-
-    # --- Limpeza ---
-    print("\n[ 4 ] Limpando arquivos temporários...")
-    files_to_clean = ["genwkl3", "simulador", "tp3.in"]
-    for f in files_to_clean:
-        if os.path.exists(f): 
-            os.remove(f)
-    print("==> Limpeza concluída.")
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    main()
@@ -0,0 +1,557 @@
+// Microbenchmarks de cada estrutura e de cada caminho de consulta, em vários
+// tamanhos de entrada, com o resultado em JSON no formato do Google Benchmark
+// (context + benchmarks, tempos em ns), para comparar entre commits.
+//
+// Uso: BenchEstruturas.out [--filtro <texto>] [--saida <arquivo.json>] [--tempo-minimo <s>]
+// Cada caso roda em lotes de iterações que dobram até o lote levar o tempo
+// mínimo; a preparação (montar a estrutura, gerar as chaves) fica fora da medida.
+#include "ArvoreClientes.h"
+#include "ArvoreEventos.h"
+#include "ArvorePacotes.h"
+#include "ArvoreRotas.h"
+#include "Cliente.h"
+#include "DiretorioClientes.h"
+#include "EscritorSaida.h"
+#include "EventosColunares.h"
+#include "Evento.h"
+#include "KernelsSimd.h"
+#include "LeitorEntrada.h"
+#include "Pacote.h"
+#include "RespostaConsulta.h"
+#include "Simulador.h"
+#include "TabelaNomes.h"
+#include "TabelaPacotes.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+static const int TAMANHOS[] = {1 << 10, 1 << 14, 1 << 18};
+static const int TOTAL_TAMANHOS = sizeof(TAMANHOS) / sizeof(TAMANHOS[0]);
+static const int CHAVES = 4096; // Chaves de busca pré-sorteadas, usadas em ciclo
+static const int ARMAZENS = 32;
+
+// Passadas pelo Makefile (-DTP3_FLAGS_BENCH); compilado à mão, não se sabe
+#ifdef TP3_FLAGS_BENCH
+static const char* FLAGS_COMPILACAO = TP3_FLAGS_BENCH;
+#else
+static const char* FLAGS_COMPILACAO = "desconhecidas";
+#endif
+
+struct Medicao {
+    string nome;
+    long long iteracoes;
+    double nsReal;        // Por iteração
+    double nsCpu;
+    double itensPorSegundo;
+};
+
+static Medicao* medicoes = nullptr;
+static int totalMedicoes = 0;
+static int capacidadeMedicoes = 0;
+static const char* filtro = nullptr;
+static double tempoMinimo = 0.2;
+static volatile long long sumidouro; // Impede que o compilador descarte os resultados
+
+static double agora() {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static double agoraCpu() {
+    timespec t;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static bool selecionado(const string& nome) {
+    return !filtro || nome.find(filtro) != string::npos;
+}
+
+static void registrar(const Medicao& m) {
+    if (totalMedicoes == capacidadeMedicoes) {
+        int novaCapacidade = capacidadeMedicoes ? capacidadeMedicoes * 2 : 64;
+        Medicao* novas = new Medicao[novaCapacidade];
+        for (int i = 0; i < totalMedicoes; i++) novas[i] = medicoes[i];
+        delete[] medicoes;
+        medicoes = novas;
+        capacidadeMedicoes = novaCapacidade;
+    }
+    medicoes[totalMedicoes++] = m;
+    fprintf(stderr, "%-40s %12lld it %14.1f ns/it %14.0f itens/s\n",
+            m.nome.c_str(), m.iteracoes, m.nsReal, m.itensPorSegundo);
+}
+
+// Roda corpo() em lotes que dobram até um lote levar tempoMinimo. Cada
+// chamada de corpo() retorna quantos elementos processou (eventos lidos,
+// linhas devolvidas, rotas ordenadas...), somados no lote medido.
+template <typename Corpo>
+static void medirItens(const string& nome, Corpo corpo) {
+    long long iteracoes = 1;
+    long long itens;
+    double real, cpu;
+    while (true) {
+        itens = 0;
+        double inicio = agora();
+        double inicioCpu = agoraCpu();
+        for (long long i = 0; i < iteracoes; i++) itens += corpo();
+        real = agora() - inicio;
+        cpu = agoraCpu() - inicioCpu;
+        if (real >= tempoMinimo || iteracoes >= (1LL << 30)) break;
+        iteracoes *= 2;
+    }
+
+    Medicao m;
+    m.nome = nome;
+    m.iteracoes = iteracoes;
+    m.nsReal = real * 1e9 / iteracoes;
+    m.nsCpu = cpu * 1e9 / iteracoes;
+    m.itensPorSegundo = real > 0 ? itens / real : 0;
+    registrar(m);
+}
+
+// Para os casos em que toda chamada processa o mesmo número de elementos
+template <typename Corpo>
+static void medir(const string& nome, long long itensPorIteracao, Corpo corpo) {
+    medirItens(nome, [&] {
+        corpo();
+        return itensPorIteracao;
+    });
+}
+
+static string nomeCaso(const char* caso, int n) {
+    return string(caso) + "/" + to_string(n);
+}
+
+static int sortear(int limite) {
+    return static_cast<int>(((static_cast<unsigned>(rand()) << 15) ^ static_cast<unsigned>(rand())) % limite);
+}
+
+static string nomeCliente(int i) {
+    char texto[16];
+    snprintf(texto, sizeof(texto), "C%06d", i);
+    return texto;
+}
+
+// Eventos com tempos crescentes, como na entrada real
+static Evento* gerarEventos(int n) {
+    Evento* eventos = static_cast<Evento*>(::operator new(sizeof(Evento) * n));
+    for (int i = 0; i < n; i++) {
+        new (&eventos[i]) Evento(i, TR, sortear(n), -1, -1, sortear(ARMAZENS), sortear(ARMAZENS));
+        eventos[i].sequencia = i;
+    }
+    return eventos;
+}
+
+// ---- Estruturas ----
+
+static void benchArvoreEventos(int n) {
+    Evento* eventos = gerarEventos(n);
+    if (selecionado(nomeCaso("ArvoreEventos/inserir", n))) {
+        medir(nomeCaso("ArvoreEventos/inserir", n), n, [&] {
+            ArvoreEventos arvore;
+            for (int i = 0; i < n; i++) arvore.inserir(&eventos[i]);
+            sumidouro = arvore.tamanho();
+        });
+    }
+    if (selecionado(nomeCaso("ArvoreEventos/intervalo", n))) {
+        ArvoreEventos arvore;
+        for (int i = 0; i < n; i++) arvore.inserir(&eventos[i]);
+        int largura = n / 100 > 0 ? n / 100 : 1; // 1% dos eventos por busca
+        int consulta = 0;
+        medirItens(nomeCaso("ArvoreEventos/intervalo", n), [&] {
+            int inicio = (consulta++ * 7919) % n;
+            long long encontrados = arvore.getEventosNoIntervalo(inicio, inicio + largura).getTamanho();
+            sumidouro = encontrados;
+            return encontrados;
+        });
+    }
+    ::operator delete(eventos);
+}
+
+// Mesmos eventos e intervalos da ArvoreEventos, no armazenamento padrão. O
+// caso foraDeOrdem atrasa um a cada 16 eventos, que passam pelo run lateral.
+static void benchEventosColunares(int n) {
+    Evento* eventos = gerarEventos(n);
+    if (selecionado(nomeCaso("EventosColunares/inserir", n))) {
+        medir(nomeCaso("EventosColunares/inserir", n), n, [&] {
+            EventosColunares colunas;
+            for (int i = 0; i < n; i++) colunas.inserir(&eventos[i]);
+            sumidouro = colunas.getTamanho();
+        });
+    }
+    if (selecionado(nomeCaso("EventosColunares/inserirForaDeOrdem", n))) {
+        int* ordem = new int[n];
+        for (int i = 0; i < n; i++) ordem[i] = i;
+        // Troca o primeiro de cada grupo de 16 com o último: o último chega
+        // 15 posições antes e o primeiro, 15 depois, como um atrasado
+        for (int i = 0; i + 15 < n; i += 16) {
+            int troca = ordem[i];
+            ordem[i] = ordem[i + 15];
+            ordem[i + 15] = troca;
+        }
+        medir(nomeCaso("EventosColunares/inserirForaDeOrdem", n), n, [&] {
+            EventosColunares colunas;
+            for (int i = 0; i < n; i++) colunas.inserir(&eventos[ordem[i]]);
+            sumidouro = colunas.getTamanho();
+        });
+        delete[] ordem;
+    }
+    if (selecionado(nomeCaso("EventosColunares/intervalo", n))) {
+        EventosColunares colunas;
+        for (int i = 0; i < n; i++) colunas.inserir(&eventos[i]);
+        colunas.prepararLeitura();
+        int largura = n / 100 > 0 ? n / 100 : 1;
+        int consulta = 0;
+        medirItens(nomeCaso("EventosColunares/intervalo", n), [&] {
+            int inicio = (consulta++ * 7919) % n;
+            int primeira = colunas.limiteInferior(inicio);
+            int fim = colunas.limiteSuperior(inicio + largura);
+            long long soma = 0;
+            for (int linha = primeira; linha < fim; linha++) soma += colunas.getEvento(linha)->idPacote;
+            sumidouro = soma;
+            return static_cast<long long>(fim - primeira);
+        });
+    }
+    ::operator delete(eventos);
+}
+
+static void benchPacotes(int n) {
+    Pacote** pacotes = new Pacote*[n];
+    for (int i = 0; i < n; i++) pacotes[i] = new Pacote(i);
+    int chaves[CHAVES];
+    for (int i = 0; i < CHAVES; i++) chaves[i] = sortear(n);
+
+    if (selecionado(nomeCaso("ArvorePacotes/buscar", n))) {
+        ArvorePacotes arvore;
+        for (int i = 0; i < n; i++) arvore.inserir(pacotes[i]);
+        medir(nomeCaso("ArvorePacotes/buscar", n), CHAVES, [&] {
+            long long soma = 0;
+            for (int i = 0; i < CHAVES; i++) soma += arvore.buscar(chaves[i])->getId();
+            sumidouro = soma;
+        });
+    }
+    if (selecionado(nomeCaso("TabelaPacotes/buscar", n))) {
+        TabelaPacotes tabela;
+        for (int i = 0; i < n; i++) tabela.inserir(pacotes[i]);
+        medir(nomeCaso("TabelaPacotes/buscar", n), CHAVES, [&] {
+            long long soma = 0;
+            for (int i = 0; i < CHAVES; i++) soma += tabela.buscar(chaves[i])->getId();
+            sumidouro = soma;
+        });
+    }
+
+    for (int i = 0; i < n; i++) delete pacotes[i];
+    delete[] pacotes;
+}
+
+// A ArvoreClientes busca pelo texto do nome; o DiretorioClientes, como na
+// consulta CL, interna o texto na TabelaNomes e indexa o vetor pelo ID
+static void benchClientes(int n) {
+    TabelaNomes nomes;
+    Cliente** clientes = new Cliente*[n];
+    for (int i = 0; i < n; i++) {
+        string nome = nomeCliente(i);
+        clientes[i] = new Cliente(nome, nomes.internar(nome));
+    }
+    string* chaves = new string[CHAVES];
+    for (int i = 0; i < CHAVES; i++) chaves[i] = nomeCliente(sortear(n));
+
+    if (selecionado(nomeCaso("ArvoreClientes/buscar", n))) {
+        ArvoreClientes arvore;
+        for (int i = 0; i < n; i++) arvore.inserir(clientes[i]);
+        medir(nomeCaso("ArvoreClientes/buscar", n), CHAVES, [&] {
+            long long encontrados = 0;
+            for (int i = 0; i < CHAVES; i++) encontrados += arvore.buscar(chaves[i]) != nullptr;
+            sumidouro = encontrados;
+        });
+    }
+    if (selecionado(nomeCaso("DiretorioClientes/buscar", n))) {
+        DiretorioClientes diretorio;
+        for (int i = 0; i < n; i++) diretorio.inserir(clientes[i]);
+        medir(nomeCaso("DiretorioClientes/buscar", n), CHAVES, [&] {
+            long long encontrados = 0;
+            for (int i = 0; i < CHAVES; i++) {
+                const string& chave = chaves[i];
+                encontrados += diretorio.buscar(nomes.buscar(chave.data(), static_cast<int>(chave.size()))) != nullptr;
+            }
+            sumidouro = encontrados;
+        });
+    }
+
+    delete[] chaves;
+    for (int i = 0; i < n; i++) delete clientes[i];
+    delete[] clientes;
+}
+
+// n incrementos sobre ARMAZENS^2 rotas; a ordenação usa n rotas distintas
+static void benchRotas(int n) {
+    int* origens = new int[n];
+    int* destinos = new int[n];
+    for (int i = 0; i < n; i++) {
+        origens[i] = sortear(ARMAZENS);
+        destinos[i] = sortear(ARMAZENS);
+    }
+    if (selecionado(nomeCaso("ArvoreRotas/incrementar", n))) {
+        medir(nomeCaso("ArvoreRotas/incrementar", n), n, [&] {
+            ArvoreRotas rotas;
+            for (int i = 0; i < n; i++) rotas.incrementar(origens[i], destinos[i]);
+            sumidouro = rotas.tamanho();
+        });
+    }
+    if (selecionado(nomeCaso("ArvoreRotas/getRotasOrdenadas", n))) {
+        ArvoreRotas rotas;
+        for (int i = 0; i < n; i++) {
+            int repeticoes = 1 + sortear(8);
+            for (int r = 0; r < repeticoes; r++) rotas.incrementar(i % 1024, i / 1024);
+        }
+        medirItens(nomeCaso("ArvoreRotas/getRotasOrdenadas", n), [&] {
+            long long ordenadas = rotas.getRotasOrdenadas().getTamanho();
+            sumidouro = ordenadas;
+            return ordenadas;
+        });
+    }
+    delete[] origens;
+    delete[] destinos;
+}
+
+// Linhas de evento de todos os tipos, no formato da entrada
+static string* gerarLinhas(int n) {
+    static const char* TIPOS[] = {"RG", "AR", "RM", "UR", "TR", "EN"};
+    string* linhas = new string[n];
+    char texto[96];
+    for (int i = 0; i < n; i++) {
+        int tipo = i % 6;
+        if (tipo == 0) {
+            snprintf(texto, sizeof(texto), "%07d EV RG %03d %s %s %03d %03d", i, sortear(n),
+                     nomeCliente(sortear(1000)).c_str(), nomeCliente(sortear(1000)).c_str(),
+                     sortear(ARMAZENS), sortear(ARMAZENS));
+        } else {
+            snprintf(texto, sizeof(texto), "%07d EV %s %03d %03d %03d %03d", i, TIPOS[tipo], sortear(n),
+                     sortear(ARMAZENS), sortear(ARMAZENS), sortear(10));
+        }
+        linhas[i] = texto;
+    }
+    return linhas;
+}
+
+static void benchLeitura(int n) {
+    string* linhas = gerarLinhas(n);
+    if (selecionado(nomeCaso("Evento/lerEvento", n))) {
+        TabelaNomes nomes;
+        medir(nomeCaso("Evento/lerEvento", n), n, [&] {
+            long long soma = 0;
+            for (int i = 0; i < n; i++) soma += Evento::lerEvento(linhas[i], nomes).idPacote;
+            sumidouro = soma;
+        });
+    }
+    if (selecionado(nomeCaso("LeitorEntrada/interpretar", n))) {
+        LinhaEntrada linha;
+        medir(nomeCaso("LeitorEntrada/interpretar", n), n, [&] {
+            long long soma = 0;
+            for (int i = 0; i < n; i++) {
+                LeitorEntrada::interpretar(Fatia(linhas[i].data(), static_cast<int>(linhas[i].size())), linha);
+                soma += linha.evento.idPacote;
+            }
+            sumidouro = soma;
+        });
+    }
+    if (selecionado(nomeCaso("Evento/escreverEvento", n))) {
+        TabelaNomes nomes;
+        Evento* eventos = static_cast<Evento*>(::operator new(sizeof(Evento) * n));
+        for (int i = 0; i < n; i++) new (&eventos[i]) Evento(Evento::lerEvento(linhas[i], nomes));
+        EscritorSaida saida(EscritorSaida::MEMORIA);
+        medir(nomeCaso("Evento/escreverEvento", n), n, [&] {
+            saida.limpar();
+            for (int i = 0; i < n; i++) escreverEvento(saida, eventos[i], nomes);
+            sumidouro = static_cast<long long>(saida.getUsado());
+        });
+        ::operator delete(eventos);
+    }
+    delete[] linhas;
+}
+
+// ---- Consultas ----
+
+// Destino que só conta os itens (eventos ou rotas), para medir a consulta
+// sem a formatação
+class DestinoContador : public DestinoResposta {
+public:
+    long long itens;
+    DestinoContador() : itens(0) {}
+    void iniciar(const CabecalhoResposta&) override {}
+    void adicionar(const ItemResposta&) override { itens++; }
+};
+
+// n pacotes, cada um com o ciclo RG, AR, RM, TR, AR, RM, EN entre dois
+// armazéns, e n/8 clientes. Os tempos crescem rodada a rodada.
+static void montarSimulador(Simulador& simulador, int n) {
+    int clientes = n / 8 > 0 ? n / 8 : 1;
+    int* origens = new int[n];
+    int* destinos = new int[n];
+    for (int i = 0; i < n; i++) {
+        origens[i] = sortear(ARMAZENS);
+        destinos[i] = (origens[i] + 1 + sortear(ARMAZENS - 1)) % ARMAZENS;
+    }
+    for (int etapa = 0; etapa < 7; etapa++) {
+        for (int i = 0; i < n; i++) {
+            int tempo = etapa * n + i;
+            int o = origens[i], d = destinos[i];
+            Evento ev(tempo, RG, i);
+            switch (etapa) {
+                case 0:
+                    ev = Evento(tempo, RG, i, simulador.getNomes().internar(nomeCliente(sortear(clientes))),
+                                simulador.getNomes().internar(nomeCliente(sortear(clientes))), o, d);
+                    break;
+                case 1: ev = Evento(tempo, AR, i, -1, -1, o, d, 1); break;
+                case 2: ev = Evento(tempo, RM, i, -1, -1, o, d); break;
+                case 3: ev = Evento(tempo, TR, i, -1, -1, o, d); break;
+                case 4: ev = Evento(tempo, AR, i, -1, -1, d, d, 2); break;
+                case 5: ev = Evento(tempo, RM, i, -1, -1, d, d); break;
+                default: ev = Evento(tempo, EN, i, -1, -1, -1, d); break;
+            }
+            simulador.processarEvento(ev);
+        }
+    }
+    delete[] origens;
+    delete[] destinos;
+}
+
+static void benchConsultas(int n) {
+    static const char* CASOS[] = {"Consulta/PC", "Consulta/CL", "Consulta/MA", "Consulta/RC"};
+    bool algum = false;
+    for (int c = 0; c < 4; c++) algum = algum || selecionado(nomeCaso(CASOS[c], n));
+    if (!algum) return;
+
+    int devNull = open("/dev/null", O_WRONLY);
+    Simulador simulador(devNull);
+    montarSimulador(simulador, n);
+    int clientes = n / 8 > 0 ? n / 8 : 1;
+    int totalTempo = 7 * n;
+
+    Consulta* consultas = new Consulta[CHAVES];
+    string* nomes = new string[CHAVES];
+    for (int tipo = CONSULTA_PC; tipo <= CONSULTA_RC; tipo++) {
+        string nome = nomeCaso(CASOS[tipo], n);
+        if (!selecionado(nome)) continue;
+        for (int i = 0; i < CHAVES; i++) {
+            Consulta& consulta = consultas[i];
+            consulta = Consulta();
+            consulta.tempo = totalTempo;
+            consulta.tipo = static_cast<TipoConsulta>(tipo);
+            consulta.camposCompletos = true;
+            nomes[i] = nomeCliente(sortear(clientes));
+            consulta.idPacote = sortear(n);
+            consulta.nomeCliente = Fatia(nomes[i].data(), static_cast<int>(nomes[i].size()));
+            consulta.tempoInicio = sortear(totalTempo);
+            consulta.tempoFim = consulta.tempoInicio + totalTempo / 100; // 1% do período
+            consulta.idArmazem = sortear(ARMAZENS);
+        }
+        DestinoContador destino;
+        int proxima = 0;
+        // Elementos processados: os itens devolvidos por cada consulta
+        medirItens(nome, [&] {
+            long long antes = destino.itens;
+            simulador.avaliarConsulta(consultas[proxima], destino);
+            proxima = (proxima + 1) % CHAVES;
+            return destino.itens - antes;
+        });
+        sumidouro = destino.itens;
+    }
+    delete[] consultas;
+    delete[] nomes;
+    close(devNull);
+}
+
+// ---- Saída JSON ----
+
+static void escreverTextoJson(FILE* f, const string& texto) {
+    fputc('"', f);
+    for (char c : texto) {
+        if (c == '"' || c == '\\') fputc('\\', f);
+        fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+static void escreverJson(FILE* f) {
+    char data[32];
+    time_t t = time(nullptr);
+    strftime(data, sizeof(data), "%Y-%m-%dT%H:%M:%S", localtime(&t));
+    fprintf(f, "{\n  \"context\": {\n");
+    fprintf(f, "    \"date\": \"%s\",\n", data);
+    fprintf(f, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    fprintf(f, "    \"simd\": \"%s\",\n", getNomeNivelSimd(getNivelSimd()));
+    fprintf(f, "    \"min_time\": %g,\n", tempoMinimo);
+    // O tipo segue a otimização com que o bench foi compilado (NDEBUG nunca
+    // é definido pelo Makefile); as flags vêm do Makefile, em BENCH_FLAGS
+#ifdef __OPTIMIZE__
+    fprintf(f, "    \"library_build_type\": \"release\",\n");
+#else
+    fprintf(f, "    \"library_build_type\": \"debug\",\n");
+#endif
+    fprintf(f, "    \"build_flags\": ");
+    escreverTextoJson(f, FLAGS_COMPILACAO);
+    fprintf(f, "\n");
+    fprintf(f, "  },\n  \"benchmarks\": [\n");
+    for (int i = 0; i < totalMedicoes; i++) {
+        const Medicao& m = medicoes[i];
+        fprintf(f, "    {\n      \"name\": ");
+        escreverTextoJson(f, m.nome);
+        fprintf(f, ",\n      \"run_name\": ");
+        escreverTextoJson(f, m.nome);
+        fprintf(f, ",\n      \"run_type\": \"iteration\",\n");
+        fprintf(f, "      \"iterations\": %lld,\n", m.iteracoes);
+        fprintf(f, "      \"real_time\": %.3f,\n", m.nsReal);
+        fprintf(f, "      \"cpu_time\": %.3f,\n", m.nsCpu);
+        fprintf(f, "      \"time_unit\": \"ns\",\n");
+        fprintf(f, "      \"items_per_second\": %.1f\n", m.itensPorSegundo);
+        fprintf(f, "    }%s\n", i + 1 < totalMedicoes ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+int main(int argc, char** argv) {
+    const char* arquivoSaida = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filtro") == 0 && i + 1 < argc) {
+            filtro = argv[++i];
+        } else if (strcmp(argv[i], "--saida") == 0 && i + 1 < argc) {
+            arquivoSaida = argv[++i];
+        } else if (strcmp(argv[i], "--tempo-minimo") == 0 && i + 1 < argc) {
+            tempoMinimo = atof(argv[++i]);
+        } else {
+            fprintf(stderr, "Uso: %s [--filtro <texto>] [--saida <arquivo.json>] [--tempo-minimo <s>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    srand(42);
+    for (int t = 0; t < TOTAL_TAMANHOS; t++) {
+        int n = TAMANHOS[t];
+        benchArvoreEventos(n);
+        benchEventosColunares(n);
+        benchPacotes(n);
+        benchClientes(n);
+        benchRotas(n);
+        benchLeitura(n);
+        benchConsultas(n);
+    }
+
+    // O progresso vai para stderr; o JSON, para o arquivo ou para stdout
+    FILE* f = arquivoSaida ? fopen(arquivoSaida, "w") : stdout;
+    if (!f) {
+        fprintf(stderr, "Erro ao criar %s\n", arquivoSaida);
+        return 1;
+    }
+    escreverJson(f);
+    if (arquivoSaida) fclose(f);
+    delete[] medicoes;
+    return 0;
+}
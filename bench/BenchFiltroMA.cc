@@ -0,0 +1,136 @@
+// Microbenchmark dos kernels da consulta MA: compara o laço antigo (evento a
+// evento, sobre cópias de Evento) com a varredura de colunas em cada nível
+// SIMD disponível, para o filtro por armazém e para os limites de tempo.
+#include "Evento.h"
+#include "KernelsSimd.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+static const int LINHAS = 1 << 20;
+static const int ARMAZENS = 50;
+static const int REPETICOES = 50;
+
+static double agora() {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// O laço de processarConsultaMovimentacaoArmazem antes das colunas
+static int filtrarEventos(const Evento* eventos, int n, int idArmazem, int* indices) {
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        Evento ev = eventos[i];
+        if (ev.armazemOrigem == idArmazem || ev.armazemDestino == idArmazem) {
+            indices[total++] = i;
+        }
+    }
+    return total;
+}
+
+static int limiteLinear(const int* tempos, int n, int tempo) {
+    int i = 0;
+    while (i < n && tempos[i] < tempo) i++;
+    return i;
+}
+
+// Imprime o custo por unidade (linha ou busca) e o ganho sobre a referência
+static void relatar(const char* nome, double segundos, long long unidades, double referencia, const char* unidade) {
+    double ns = segundos * 1e9 / unidades;
+    printf("%-28s %8.3f ns/%-6s %6.2fx\n", nome, ns, unidade, referencia / ns);
+}
+
+int main() {
+    srand(42);
+    Evento* eventos = static_cast<Evento*>(::operator new(sizeof(Evento) * LINHAS));
+    int* origens = new int[LINHAS];
+    int* destinos = new int[LINHAS];
+    int* tempos = new int[LINHAS];
+    int tempo = 0;
+    for (int i = 0; i < LINHAS; i++) {
+        tempo += rand() % 3;
+        origens[i] = rand() % ARMAZENS;
+        destinos[i] = rand() % ARMAZENS;
+        tempos[i] = tempo;
+        new (&eventos[i]) Evento(tempo, TR, i, -1, -1, origens[i], destinos[i]);
+    }
+    int* indices = new int[LINHAS];
+    int* esperado = new int[LINHAS];
+
+    printf("Filtro MA (%d linhas, %d armazens)\n", LINHAS, ARMAZENS);
+    double inicio = agora();
+    int totalEsperado = 0;
+    for (int r = 0; r < REPETICOES; r++) {
+        totalEsperado = filtrarEventos(eventos, LINHAS, r % ARMAZENS, esperado);
+    }
+    double referencia = (agora() - inicio) * 1e9 / ((long long)LINHAS * REPETICOES);
+    relatar("laco por evento (antigo)", referencia * 1e-9, 1, referencia, "linha");
+
+    NivelSimd maximo = detectarNivelSimd();
+    int falhas = 0;
+    for (int nivel = SIMD_ESCALAR; nivel <= maximo; nivel++) {
+        selecionarNivelSimd(static_cast<NivelSimd>(nivel));
+        int total = 0;
+        inicio = agora();
+        for (int r = 0; r < REPETICOES; r++) {
+            total = filtrarArmazem(origens, destinos, LINHAS, r % ARMAZENS, indices);
+        }
+        double segundos = agora() - inicio;
+        char nome[64];
+        snprintf(nome, sizeof(nome), "colunas, %s", getNomeNivelSimd(static_cast<NivelSimd>(nivel)));
+        relatar(nome, segundos, (long long)LINHAS * REPETICOES, referencia, "linha");
+
+        // Confere com o laço antigo (última repetição) e com a contagem
+        int id = (REPETICOES - 1) % ARMAZENS;
+        if (total != totalEsperado || contarArmazem(origens, destinos, LINHAS, id) != total) falhas++;
+        for (int i = 0; i < total && i < totalEsperado; i++) {
+            if (indices[i] != esperado[i]) { falhas++; break; }
+        }
+    }
+
+    // Limites de tempo: posição do primeiro tempo >= t dentro de blocos de 64
+    const int BLOCO = 64;
+    printf("\nLimite de tempo em blocos de %d linhas\n", BLOCO);
+    long long buscas = 0;
+    long long soma = 0;
+    inicio = agora();
+    for (int r = 0; r < REPETICOES; r++) {
+        for (int b = 0; b + BLOCO <= LINHAS; b += BLOCO) {
+            soma += limiteLinear(tempos + b, BLOCO, tempos[b + (r * 7) % BLOCO]);
+            buscas++;
+        }
+    }
+    double referenciaLimite = (agora() - inicio) * 1e9 / buscas;
+    relatar("laco com desvio (antigo)", referenciaLimite * 1e-9, 1, referenciaLimite, "busca");
+
+    for (int nivel = SIMD_ESCALAR; nivel <= maximo; nivel++) {
+        selecionarNivelSimd(static_cast<NivelSimd>(nivel));
+        long long somaNivel = 0;
+        inicio = agora();
+        for (int r = 0; r < REPETICOES; r++) {
+            for (int b = 0; b + BLOCO <= LINHAS; b += BLOCO) {
+                somaNivel += contarMenores(tempos + b, BLOCO, tempos[b + (r * 7) % BLOCO]);
+            }
+        }
+        double segundos = agora() - inicio;
+        char nome[64];
+        snprintf(nome, sizeof(nome), "contarMenores, %s", getNomeNivelSimd(static_cast<NivelSimd>(nivel)));
+        relatar(nome, segundos, buscas, referenciaLimite, "busca");
+        if (somaNivel != soma) falhas++;
+    }
+
+    ::operator delete(eventos);
+    delete[] origens;
+    delete[] destinos;
+    delete[] tempos;
+    delete[] indices;
+    delete[] esperado;
+
+    if (falhas) {
+        printf("ERRO: %d kernels divergiram do laco antigo\n", falhas);
+        return 1;
+    }
+    return 0;
+}
@@ -1,9 +1,25 @@
-// A union-find algorithm to identify islands
+// Gerador de cargas para o tp3: simula o ciclo de vida completo de cada pacote
+// numa rede de armazéns e escreve os eventos e as consultas em ordem de tempo.
+//
+// A rede é um grafo aleatório conexo (union-find garante uma só ilha). Cada
+// pacote é registrado (RG), chega ao armazém de origem (AR) e segue o caminho
+// mínimo até o destino: a cada armazém espera na seção do próximo salto até a
+// próxima partida do transporte daquela ligação. Cada partida leva no máximo
+// "capacidade" pacotes; os que sobram são removidos e rearmazenados (RM, UR)
+// e esperam a partida seguinte. Os que embarcam são removidos e transportados
+// (RM, TR) e chegam ao próximo armazém depois da latência da ligação (AR), ou
+// são entregues (EN) se ele for o destino.
+//
+// A simulação é por eventos discretos: um heap guarda o próximo passo de cada
+// pacote em trânsito e o próximo registro, então a memória depende só dos
+// pacotes em trânsito e a saída é escrita em fluxo, já ordenada por tempo.
+// As consultas são intercaladas entre os eventos, com o tempo do último evento.
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <unistd.h> 
-#include <getopt.h> 
+#include <limits.h>
+#include <unistd.h>
+#include <getopt.h>
 
 typedef struct subset {
     int parent;
@@ -40,95 +56,407 @@ int rndnode(int nodes) {
 }
 
 void print_usage(char *prog_name) {
-    fprintf(stderr, "Uso: %s [-s seed] [-n nós] [-p pacotes] [-c clientes] [-t tempo]\n", prog_name);
+    fprintf(stderr, "Uso: %s [-s seed] [-n nós] [-p pacotes] [-c clientes] [-t tempo] [-g grau]\n"
+                    "          [-i intervalo] [-k capacidade] [-q consultas/1000 eventos] [-m pc:cl:ma:rc]\n"
+                    "          [-e max_eventos] [-o saida|-] [-v]\n", prog_name);
+}
+
+// ---- Rede de armazéns ----
+
+static int nodes;
+static unsigned char *adj;   // adj[a*nodes+b]: existe ligação a-b
+static int *next_hop;        // next_hop[a*nodes+d]: próximo armazém de a rumo a d
+static int *latency;         // latency[a*nodes+b]: tempo de transporte de a para b
+
+// Liga ilhas até sobrar uma e depois acrescenta ligações até o grau médio pedido
+static void build_graph(int degree, long rtime) {
+    adj = calloc((size_t)nodes * nodes, 1);
+    latency = calloc((size_t)nodes * nodes, sizeof(int));
+    subset *subsets = malloc(nodes * sizeof(subset));
+    if (!adj || !latency || !subsets) { fprintf(stderr, "Erro: memória insuficiente para a rede.\n"); exit(EXIT_FAILURE); }
+    for (int i = 0; i < nodes; i++) { subsets[i].parent = i; subsets[i].rank = 0; }
+
+    long edges = 0;
+    long max_edges = (long)nodes * (nodes - 1) / 2;
+    long wanted = (long)nodes * degree / 2;
+    if (wanted > max_edges) wanted = max_edges;
+    int islands = nodes;
+    while (islands > 1 || edges < wanted) {
+        int a = rndnode(nodes), b = rndnode(nodes);
+        if (a == b || adj[a * nodes + b]) continue;
+        if (islands > 1) {
+            // Enquanto houver ilhas, só aceita ligações que unem duas delas
+            if (Find(subsets, a) == Find(subsets, b)) continue;
+            Union(subsets, a, b);
+            islands--;
+        }
+        adj[a * nodes + b] = adj[b * nodes + a] = 1;
+        latency[a * nodes + b] = latency[b * nodes + a] = 1 + (int)(drand48() * rtime);
+        edges++;
+    }
+    free(subsets);
+}
+
+// Busca em largura a partir de cada destino: o próximo salto de a rumo a d é
+// o vizinho de a pelo qual a busca chegou em a
+static void build_routes(void) {
+    next_hop = malloc((size_t)nodes * nodes * sizeof(int));
+    int *queue = malloc(nodes * sizeof(int));
+    if (!next_hop || !queue) { fprintf(stderr, "Erro: memória insuficiente para as rotas.\n"); exit(EXIT_FAILURE); }
+    for (int d = 0; d < nodes; d++) {
+        int *to_d = next_hop + (size_t)d * nodes; // Preenchido como to_d[a], transposto abaixo
+        for (int a = 0; a < nodes; a++) to_d[a] = -1;
+        to_d[d] = d;
+        int head = 0, tail = 0;
+        queue[tail++] = d;
+        while (head < tail) {
+            int u = queue[head++];
+            for (int v = 0; v < nodes; v++) {
+                if (adj[u * nodes + v] && to_d[v] < 0) {
+                    to_d[v] = u;
+                    queue[tail++] = v;
+                }
+            }
+        }
+    }
+    // Transpõe para next_hop[a*nodes+d], que é a ordem de acesso na simulação
+    for (int a = 0; a < nodes; a++)
+        for (int d = a + 1; d < nodes; d++) {
+            int t = next_hop[(size_t)a * nodes + d];
+            next_hop[(size_t)a * nodes + d] = next_hop[(size_t)d * nodes + a];
+            next_hop[(size_t)d * nodes + a] = t;
+        }
+    free(queue);
+}
+
+// ---- Heap de passos pendentes ----
+
+enum { REGISTRO, CHEGADA, PARTIDA };
+
+typedef struct step {
+    long time;
+    long order;     // Desempate estável: passos agendados antes saem antes
+    int packet;
+    int at;         // Armazém atual (CHEGADA: armazém onde chega)
+    int dst;
+    int kind;
+} step;
+
+static step *heap;
+static long heap_size, heap_capacity, next_order;
+
+static int step_less(const step *a, const step *b) {
+    return a->time < b->time || (a->time == b->time && a->order < b->order);
+}
+
+static void push(step s) {
+    if (heap_size == heap_capacity) {
+        heap_capacity = heap_capacity ? heap_capacity * 2 : 1024;
+        heap = realloc(heap, heap_capacity * sizeof(step));
+        if (!heap) { fprintf(stderr, "Erro: memória insuficiente para o heap.\n"); exit(EXIT_FAILURE); }
+    }
+    s.order = next_order++;
+    long i = heap_size++;
+    while (i > 0 && step_less(&s, &heap[(i - 1) / 2])) {
+        heap[i] = heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap[i] = s;
+}
+
+static step pop(void) {
+    step top = heap[0];
+    step last = heap[--heap_size];
+    long i = 0;
+    while (1) {
+        long c = 2 * i + 1;
+        if (c >= heap_size) break;
+        if (c + 1 < heap_size && step_less(&heap[c + 1], &heap[c])) c++;
+        if (!step_less(&heap[c], &last)) break;
+        heap[i] = heap[c];
+        i = c;
+    }
+    if (heap_size > 0) heap[i] = last;
+    return top;
+}
+
+// ---- Saída ----
+
+static FILE *out;
+static char line[128];
+
+// Escreve v com pelo menos width dígitos (zeros à esquerda), como "%.*ld"
+static char *put_num(char *p, long v, int width) {
+    char tmp[24];
+    int n = 0;
+    do { tmp[n++] = (char)('0' + v % 10); v /= 10; } while (v > 0);
+    while (n < width) tmp[n++] = '0';
+    while (n > 0) *p++ = tmp[--n];
+    return p;
+}
+
+static char *put_str(char *p, const char *s) {
+    while (*s) *p++ = *s++;
+    return p;
+}
+
+static void put_line(char *end) {
+    *end++ = '\n';
+    fwrite(line, 1, end - line, out);
+}
+
+static long event_counts[6];
+static const char *EVENT_NAMES[] = {"RG", "AR", "RM", "UR", "TR", "EN"};
+enum { RG, AR, RM, UR, TR, EN };
+
+// "tempo EV tipo pacote" seguido dos armazéns (-1 = campo ausente)
+static void emit_event(long time, int type, int packet, int a, int b) {
+    char *p = put_num(line, time, 7);
+    p = put_str(p, " EV ");
+    p = put_str(p, EVENT_NAMES[type]);
+    *p++ = ' ';
+    p = put_num(p, packet, 3);
+    if (a >= 0) { *p++ = ' '; p = put_num(p, a, 3); }
+    if (b >= 0) { *p++ = ' '; p = put_num(p, b, 3); }
+    put_line(p);
+    event_counts[type]++;
+}
+
+static void emit_register(long time, int packet, int sender, int receiver, int src, int dst) {
+    char *p = put_num(line, time, 7);
+    p = put_str(p, " EV RG ");
+    p = put_num(p, packet, 3);
+    p = put_str(p, " n");
+    p = put_num(p, sender, 5);
+    p = put_str(p, " n");
+    p = put_num(p, receiver, 5);
+    *p++ = ' ';
+    p = put_num(p, src, 3);
+    *p++ = ' ';
+    p = put_num(p, dst, 3);
+    put_line(p);
+    event_counts[RG]++;
+}
+
+static long query_counts[4];
+
+// Uma consulta no tempo dado, sorteada conforme os pesos de mix (pc, cl, ma, rc)
+static void emit_query(long time, const int mix[4], int registered, int numclients, long window) {
+    int total = mix[0] + mix[1] + mix[2] + mix[3];
+    int r = (int)(drand48() * total);
+    int type = 0;
+    while (r >= mix[type]) r -= mix[type++];
+
+    char *p = put_num(line, time, 7);
+    switch (type) {
+        case 0:
+            p = put_str(p, " PC ");
+            p = put_num(p, rndnode(registered), 3);
+            break;
+        case 1:
+            p = put_str(p, " CL n");
+            p = put_num(p, rndnode(numclients), 5);
+            break;
+        case 2: {
+            long start = time - (long)(drand48() * window);
+            if (start < 0) start = 0;
+            p = put_str(p, " MA ");
+            p = put_num(p, start, 7);
+            *p++ = ' ';
+            p = put_num(p, time, 7);
+            *p++ = ' ';
+            p = put_num(p, rndnode(nodes), 3);
+            break;
+        }
+        default:
+            p = put_str(p, " RC");
+            break;
+    }
+    put_line(p);
+    query_counts[type]++;
+}
+
+// ---- Simulação ----
+
+static long *slot_of;  // slot_of[a*nodes+b]: última partida de a para b que recebeu pacotes
+static int *boarded;   // boarded[a*nodes+b]: pacotes embarcados nessa partida
+
+// Primeira partida depois de time (as partidas saem nos múltiplos de interval)
+static long next_departure(long time, long interval) {
+    return (time / interval + 1) * interval;
 }
 
 int main(int argc, char *argv[]) {
     // Default values
     long seed = 1;
-    int nodes = 10;
+    nodes = 10;
     int numpackets = 100;
     int numclients = 10;
     long rtime = 10;
+    int degree = 3;
+    long interval = 10;
+    int capacity = 2;
+    double queries_per_1000 = 10;
+    int mix[4] = {10, 10, 5, 5};
+    long max_events = LONG_MAX;
+    const char *output = "tp3.in";
     int verbose = 0;
 
     int opt;
-    while ((opt = getopt(argc, argv, "s:n:p:c:t:v")) != -1) {
+    while ((opt = getopt(argc, argv, "s:n:p:c:t:g:i:k:q:m:e:o:v")) != -1) {
         switch (opt) {
             case 's': seed = atol(optarg); break;
             case 'n': nodes = atoi(optarg); break;
             case 'p': numpackets = atoi(optarg); break;
             case 'c': numclients = atoi(optarg); break;
             case 't': rtime = atol(optarg); break;
+            case 'g': degree = atoi(optarg); break;
+            case 'i': interval = atol(optarg); break;
+            case 'k': capacity = atoi(optarg); break;
+            case 'q': queries_per_1000 = atof(optarg); break;
+            case 'm':
+                if (sscanf(optarg, "%d:%d:%d:%d", &mix[0], &mix[1], &mix[2], &mix[3]) != 4) {
+                    print_usage(argv[0]);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'e': max_events = atol(optarg); break;
+            case 'o': output = optarg; break;
             case 'v': verbose = 1; break;
             default:
                 print_usage(argv[0]);
                 exit(EXIT_FAILURE);
         }
     }
-    
+
     if(verbose) fprintf(stderr, "[DEBUG] genwkl3_extra iniciado com seed=%ld, nós=%d, pacotes=%d, clientes=%d\n", seed, nodes, numpackets, numclients);
 
     if (nodes <= 1) {
         fprintf(stderr, "Erro: O número de nós deve ser maior que 1.\n");
         exit(EXIT_FAILURE);
     }
+    if (nodes > 4096) {
+        fprintf(stderr, "Erro: no máximo 4096 nós (a tabela de rotas é nós x nós).\n");
+        exit(EXIT_FAILURE);
+    }
+    if (numclients < 1 || rtime < 1 || interval < 1 || capacity < 1 || degree < 1 || queries_per_1000 < 0 ||
+        mix[0] < 0 || mix[1] < 0 || mix[2] < 0 || mix[3] < 0 || mix[0] + mix[1] + mix[2] + mix[3] <= 0) {
+        fprintf(stderr, "Erro: parâmetros inválidos.\n");
+        print_usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
 
-    long atime = 1;
-    int src, dst, sender, receiver;
-    long qtime, qtime_end;
-    
-    FILE *out = fopen("tp3.in", "wt");
-    if (!out) { perror("Erro ao abrir tp3.in"); exit(EXIT_FAILURE); }
+    out = strcmp(output, "-") == 0 ? stdout : fopen(output, "wt");
+    if (!out) { perror("Erro ao abrir o arquivo de saída"); exit(EXIT_FAILURE); }
+    setvbuf(out, NULL, _IOFBF, 1 << 20);
 
     srand48(seed);
 
-    if(verbose) fprintf(stderr, "[DEBUG] Gerando %d pacotes...\n", numpackets);
-    for (int i = 0; i < numpackets; i++) {
-        do { src = rndnode(nodes); dst = rndnode(nodes); } while (src == dst);
-        atime += (long)(drand48() * rtime) + 1;
+    if(verbose) fprintf(stderr, "[DEBUG] Gerando a rede de armazéns...\n");
+    build_graph(degree, rtime);
+    build_routes();
+    slot_of = malloc((size_t)nodes * nodes * sizeof(long));
+    boarded = calloc((size_t)nodes * nodes, sizeof(int));
+    if (!slot_of || !boarded) { fprintf(stderr, "Erro: memória insuficiente.\n"); exit(EXIT_FAILURE); }
+    for (long i = 0; i < (long)nodes * nodes; i++) slot_of[i] = -1;
+
+    if(verbose) fprintf(stderr, "[DEBUG] Simulando %d pacotes...\n", numpackets);
+    double query_rate = queries_per_1000 / 1000.0;
+    long window = 100 * rtime; // Largura máxima do intervalo das consultas MA
+    long events = 0;
+    int registered = 0;
+    long max_in_transit = 0;
 
-        do { sender = rndnode(numclients); receiver = rndnode(numclients); } while (sender == receiver && numclients > 1);
-        fprintf(out, "%.7ld EV RG %.3d n%.5d n%.5d %.3d %.3d\n",
-                atime, i, sender, receiver, src, dst);
+    if (numpackets > 0) {
+        step first = {1, 0, 0, 0, 0, REGISTRO};
+        push(first);
     }
+    while (heap_size > 0) {
+        step s = pop();
+        long now = s.time;
+        if (now > INT_MAX) {
+            fprintf(stderr, "Erro: o tempo passou de %d; use um -t ou -i menor.\n", INT_MAX);
+            exit(EXIT_FAILURE);
+        }
+        long before = events;
 
-    int numcl = (numclients > 0) ? 10 : 0;
-    int numpc = (numpackets > 0) ? 10 : 0;
-    int num_ma = 5; // Número de consultas de Movimentação em Armazém
-    int num_rc = 5; // Número de consultas de Rotas Congestionadas
+        if (s.kind == REGISTRO) {
+            int src, dst, sender, receiver;
+            do { src = rndnode(nodes); dst = rndnode(nodes); } while (src == dst);
+            do { sender = rndnode(numclients); receiver = rndnode(numclients); } while (sender == receiver && numclients > 1);
+            emit_register(s.time, s.packet, sender, receiver, src, dst);
+            registered++;
+            events++;
 
-    if(verbose) fprintf(stderr, "[DEBUG] Gerando consultas...\n");
+            // Chega ao armazém de origem pouco depois do registro
+            step arrival = {s.time + 1 + (long)(drand48() * rtime), 0, s.packet, src, dst, CHEGADA};
+            push(arrival);
 
-    for (int i = 0; i < numcl; i++) {
-        qtime = (long)(drand48() * atime);
-        sender = rndnode(numclients);
-        fprintf(out, "%.7ld CL n%.5d\n", qtime, sender);
-    }
-    
-    for (int i = 0; i < numpc; i++) {
-        qtime = (long)(drand48() * atime);
-        sender = rndnode(numpackets);
-        fprintf(out, "%.7ld PC %.3d\n", qtime, sender);
-    }
-
-    // Gerar consultas MA (Movimentação em Armazém)
-    for (int i = 0; i < num_ma; i++) {
-        qtime = (long)(drand48() * atime);
-        qtime_end = qtime + (long)(drand48() * (atime - qtime));
-        int armazem = rndnode(nodes);
-        fprintf(out, "%.7ld MA %.7ld %.7ld %.3d\n", qtime, qtime, qtime_end, armazem);
-    }
+            // O próximo registro só entra no heap agora, então ele nunca passa de
+            // pacotes em trânsito + 1
+            if (registered < numpackets && events < max_events) {
+                step reg = {s.time + 1 + (long)(drand48() * rtime), 0, s.packet + 1, 0, 0, REGISTRO};
+                push(reg);
+            }
+        } else if (s.kind == CHEGADA) {
+            if (s.at == s.dst) {
+                emit_event(s.time, EN, s.packet, s.at, -1);
+                events++;
+            } else {
+                // Guardado na seção do próximo salto até a próxima partida
+                int hop = next_hop[(size_t)s.at * nodes + s.dst];
+                emit_event(s.time, AR, s.packet, s.at, hop);
+                events++;
+                step departure = {next_departure(s.time, interval), 0, s.packet, s.at, s.dst, PARTIDA};
+                push(departure);
+            }
+        } else {
+            int hop = next_hop[(size_t)s.at * nodes + s.dst];
+            size_t link = (size_t)s.at * nodes + hop;
+            if (slot_of[link] != s.time) {
+                slot_of[link] = s.time;
+                boarded[link] = 0;
+            }
+            emit_event(s.time, RM, s.packet, s.at, hop);
+            if (boarded[link] < capacity) {
+                boarded[link]++;
+                emit_event(s.time, TR, s.packet, s.at, hop);
+                step arrival = {s.time + latency[link], 0, s.packet, hop, s.dst, CHEGADA};
+                push(arrival);
+            } else {
+                // Transporte lotado: volta para a mesma seção e espera a próxima partida
+                emit_event(s.time, UR, s.packet, s.at, hop);
+                s.time += interval;
+                push(s);
+            }
+            events += 2;
+        }
 
-    // Gerar consultas RC (Rotas Congestionadas)
-    for (int i = 0; i < num_rc; i++) {
-        qtime = (long)(drand48() * atime);
-        fprintf(out, "%.7ld RC\n", qtime);
+        // Em média queries_per_1000 consultas a cada 1000 eventos
+        for (long e = before; e < events && registered > 0; e++) {
+            if (drand48() < query_rate) emit_query(now, mix, registered, numclients, window);
+        }
+        if (heap_size > max_in_transit) max_in_transit = heap_size;
     }
 
+    if (ferror(out)) { perror("Erro ao escrever a saída"); exit(EXIT_FAILURE); }
+    if (out != stdout) fclose(out);
+    else fflush(out);
 
-    if(verbose) fprintf(stderr, "[DEBUG] Geração de dados concluída. Fechando arquivo.\n");
-    fclose(out);
+    if (verbose) {
+        fprintf(stderr, "[DEBUG] %ld eventos (RG %ld, AR %ld, RM %ld, UR %ld, TR %ld, EN %ld), %d pacotes, "
+                        "máximo de %ld em trânsito\n", events, event_counts[RG], event_counts[AR], event_counts[RM],
+                event_counts[UR], event_counts[TR], event_counts[EN], registered, max_in_transit);
+        fprintf(stderr, "[DEBUG] consultas: PC %ld, CL %ld, MA %ld, RC %ld\n",
+                query_counts[0], query_counts[1], query_counts[2], query_counts[3]);
+        fprintf(stderr, "[DEBUG] Geração de dados concluída.\n");
+    }
 
+    free(heap);
+    free(adj);
+    free(latency);
+    free(next_hop);
+    free(slot_of);
+    free(boarded);
     return 0;
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #ifndef ARVORE_CLIENTES_H
 #define ARVORE_CLIENTES_H
 #include "Cliente.h"
+#include "PoolObjetos.h"
 #include <string>
 
 struct NoCliente {
@@ -17,7 +18,7 @@ private:
     NoCliente* raiz;
     int contador;
 
-    void limpar(NoCliente* no);
+    PoolObjetos<NoCliente> nos; // Nós alocados em blocos e liberados juntos
     int altura(NoCliente* no) const;
     int getBalanceamento(NoCliente* no) const;
     void setAltura(NoCliente* no);
@@ -3,6 +3,7 @@
 
 #include "Evento.h"
 #include "ListaEventos.h"
+#include "PoolObjetos.h"
 #include <string>
 
 struct NoEvento {
@@ -19,7 +20,7 @@ private:
     NoEvento* raiz;
     int contador;
 
-    void limpar(NoEvento* no);
+    PoolObjetos<NoEvento> nos; // Nós alocados em blocos e liberados juntos
     int altura(NoEvento* no) const;
     int getBalanceamento(NoEvento* no) const;
     void setAltura(NoEvento* no);
@@ -27,11 +28,11 @@ private:
     NoEvento* rotacaoEsquerda(NoEvento* x);
     NoEvento* balancear(NoEvento* no);
     NoEvento* inserirNo(NoEvento* no, Evento* dados);
-    NoEvento* removerNo(NoEvento* no, int chave);
-    NoEvento* buscarNo(NoEvento* no, int chave) const;
+    NoEvento* removerNo(NoEvento* no, const ChaveEvento& chave);
+    NoEvento* buscarNo(NoEvento* no, const ChaveEvento& chave) const;
     NoEvento* noMinimo(NoEvento* no) const;
     void emOrdem(NoEvento* no, void (*visitar)(Evento*)) const;
-    int getChave(Evento* evento) const;
+    ChaveEvento getChave(Evento* evento) const;
     void coletarEmOrdem(NoEvento* no, ListaEventos& lista) const;
     void coletarNoIntervalo(NoEvento* no, int tempoInicio, int tempoFim, ListaEventos& lista) const;
 
@@ -44,8 +45,8 @@ public:
     ArvoreEventos& operator=(const ArvoreEventos&) = delete;
 
     void inserir(Evento* dados);
-    void remover(int chave);
-    Evento* buscar(int chave) const;
+    void remover(const ChaveEvento& chave);
+    Evento* buscar(const ChaveEvento& chave) const;
     void emOrdem(void (*visitar)(Evento*)) const;
     int tamanho() const;
     ListaEventos getTodosEventos() const;
@@ -2,6 +2,7 @@
 #define ARVORE_PACOTES_H
 
 #include "Pacote.h"
+#include "PoolObjetos.h"
 
 struct NoPacote {
     Pacote* pacote;
@@ -17,7 +18,7 @@ private:
     NoPacote* raiz;
     int totalPacotes; 
 
-    void limpar(NoPacote* no);
+    PoolObjetos<NoPacote> nos; // Nós alocados em blocos e liberados juntos
     int altura(NoPacote* no) const;
     int fatorBalanceamento(NoPacote* no) const;
     void atualizarAltura(NoPacote* no);
@@ -2,6 +2,7 @@
 #define ARVORE_ROTAS_H
 
 #include "ListaRotas.h"
+#include "PoolObjetos.h"
 
 struct NoRota {
     Rota dados;
@@ -12,12 +13,27 @@ struct NoRota {
     NoRota(int origem, int destino);
 };
 
+// Nó da árvore de ranking: aponta para a rota guardada na árvore principal
+// e é ordenado por contagem decrescente e, em empate, pela chave da rota.
+struct NoRanking {
+    Rota* rota;
+    NoRanking *esquerda;
+    NoRanking *direita;
+    int altura;
+
+    NoRanking(Rota* rota);
+};
+
 class ArvoreRotas {
 private:
     NoRota* raiz;
+    NoRanking* raizRanking; // Rotas ordenadas por contagem, mantidas a cada incremento
+    int totalRotas;
+
+    PoolObjetos<NoRota> nos;
+    PoolObjetos<NoRanking> nosRanking;
 
     // Funções auxiliares da AVL
-    void limpar(NoRota* no);
     int altura(NoRota* no) const;
     void setAltura(NoRota* no);
     int getBalanceamento(NoRota* no) const;
@@ -31,14 +47,33 @@ private:
     NoRota* inserirNo(NoRota* no, int origem, int destino);
     NoRota* buscarNo(NoRota* no, int origem, int destino) const;
     
-    void coletarRotas(NoRota* no, ListaRotas& lista) const;
+    // Funções auxiliares da AVL de ranking
+    int altura(NoRanking* no) const;
+    void setAltura(NoRanking* no);
+    int getBalanceamento(NoRanking* no) const;
+    bool vemAntes(int contagemA, long long chaveA, const Rota& b) const;
+
+    NoRanking* rotacaoDireita(NoRanking* y);
+    NoRanking* rotacaoEsquerda(NoRanking* x);
+    NoRanking* balancear(NoRanking* no);
+
+    NoRanking* inserirRanking(NoRanking* no, NoRanking* novo);
+    NoRanking* removerRanking(NoRanking* no, int contagem, long long chave, NoRanking*& removido);
+    NoRanking* removerMinimoRanking(NoRanking* no, NoRanking*& minimo);
+
+    void coletarRotas(NoRanking* no, ListaRotas& lista, int limite) const;
 
 public:
     ArvoreRotas();
     ~ArvoreRotas();
 
     void incrementar(int origem, int destino);
-    ListaRotas getRotasOrdenadas() const;
+    // Cria a rota já com a contagem dada (restauração de snapshot); a rota
+    // ainda não pode existir
+    void restaurar(int origem, int destino, int contagem);
+    // Rotas por contagem decrescente; limite < 0 retorna todas
+    ListaRotas getRotasOrdenadas(int limite = -1) const;
+    int tamanho() const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+
+// CRC-32 (polinômio 0xEDB88320, o mesmo do zlib). Para calcular em partes,
+// passe o resultado anterior em crc; o valor inicial é 0.
+uint32_t calcularCrc32(const void* dados, size_t tamanho, uint32_t crc = 0);
+
+#endif
@@ -2,24 +2,31 @@
 #define CLIENTE_H
 #include <string>
 #include "ListaInt.h"
+#include "ResumoCliente.h"
 
 /**
  * @brief Representa um cliente com nome e listas de pacotes enviados e recebidos.
+ * O ID é o mesmo do nome na TabelaNomes do simulador.
  */
 class Cliente {
 
     std::string nome;
+    int id;
     ListaInt pacotesRemetente; 
     ListaInt pacotesDestinatario; 
+    ResumoCliente resumo; // Primeiro e último evento dos pacotes, em ordem
 
 public:
-    Cliente(const std::string& nome);
+    Cliente(const std::string& nome, int id = -1);
     const std::string& getNome() const;
+    int getId() const;
     void adicionarPacoteRemetente(int idPacote);
     void imprimeCliente() const;
     void adicionarPacoteDestinatario(int idPacote);
     const ListaInt& getPacotesDestinatario() const; 
     const ListaInt& getPacotesRemetente() const; 
+    ResumoCliente& getResumo();
+    const ResumoCliente& getResumo() const;
 
 };
 
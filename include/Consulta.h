@@ -0,0 +1,30 @@
+#ifndef CONSULTA_H
+#define CONSULTA_H
+
+#include "Fatia.h"
+
+enum TipoConsulta {
+    CONSULTA_PC, CONSULTA_CL, CONSULTA_MA, CONSULTA_RC
+};
+
+// Consulta já interpretada a partir de uma linha da entrada.
+// Campos que não se aplicam ao tipo ficam com -1.
+struct Consulta {
+    int tempo;
+    TipoConsulta tipo;
+    int idPacote;          // PC
+    Fatia nomeCliente;     // CL
+    int tempoInicio;       // MA
+    int tempoFim;          // MA
+    int idArmazem;         // MA
+    int limite;            // RC k (-1 = todas as rotas)
+    bool camposCompletos;  // false se faltou algum campo obrigatório
+    Fatia linha;           // texto original, usado nas mensagens de erro
+
+    Consulta() : tempo(0), tipo(CONSULTA_PC), idPacote(-1), tempoInicio(-1), tempoFim(-1),
+                 idArmazem(-1), limite(-1), camposCompletos(false) {}
+
+    const char* getNomeTipo() const;
+};
+
+#endif
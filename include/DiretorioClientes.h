@@ -0,0 +1,42 @@
+#ifndef DIRETORIO_CLIENTES_H
+#define DIRETORIO_CLIENTES_H
+
+#include "Cliente.h"
+
+// Diretório de clientes indexado pelo ID do nome na TabelaNomes do
+// Simulador (Cliente::getId()). Os IDs são densos, então os clientes ficam
+// num vetor acessado direto pelo ID: quem já internou o nome (os eventos RG
+// guardam só os IDs) encontra o cliente sem calcular outro hash, e quem só
+// tem o texto (consulta CL) faz uma única busca, em TabelaNomes::buscar.
+class DiretorioClientes {
+private:
+    Cliente** vetor; // vetor[idNome], nullptr se o nome não tem cliente
+    int capacidade;
+    int contador;
+
+    void crescer(int idNome);
+
+public:
+    DiretorioClientes();
+    ~DiretorioClientes();
+
+    DiretorioClientes(const DiretorioClientes&) = delete;
+    DiretorioClientes& operator=(const DiretorioClientes&) = delete;
+
+    // Insere o cliente na posição do seu ID; se já existir um com o mesmo
+    // ID, ele é substituído
+    void inserir(Cliente* dados);
+    void remover(int idNome);
+    // nullptr se não houver cliente com esse ID (inclusive para -1, o
+    // retorno de TabelaNomes::buscar para nomes desconhecidos)
+    Cliente* buscar(int idNome) const {
+        return idNome >= 0 && idNome < capacidade ? vetor[idNome] : nullptr;
+    }
+    int tamanho() const;
+
+    // Visita os clientes em ordem alfabética. Ordena sob demanda, então só
+    // deve ser usado onde a ordem realmente importa.
+    void emOrdem(void (*visitar)(Cliente*)) const;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef ESCRITOR_SAIDA_H
+#define ESCRITOR_SAIDA_H
+
+#include <string>
+#include <cstddef>
+
+// Escritor de saída com buffer próprio. Formata números direto no buffer
+// (com uma tabela de pares de dígitos) e só chama write() quando o buffer
+// enche ou quando descarregar() é chamado. Pode escrever na saída padrão ou
+// em qualquer descritor de arquivo; com fd = MEMORIA não escreve em lugar
+// nenhum: o buffer cresce e o texto fica disponível em getDados().
+class EscritorSaida {
+private:
+    int fd;
+    char* buffer;
+    size_t capacidade;
+    size_t usado;
+
+    void garantirEspaco(size_t bytes);
+
+public:
+    static const size_t CAPACIDADE_PADRAO = 1 << 16;
+    static const int MEMORIA = -1;
+
+    explicit EscritorSaida(int fd = 1, size_t capacidade = CAPACIDADE_PADRAO);
+    ~EscritorSaida();
+
+    EscritorSaida(const EscritorSaida&) = delete;
+    EscritorSaida& operator=(const EscritorSaida&) = delete;
+
+    void escreverTexto(const char* texto, size_t tamanho);
+    void escreverTexto(const std::string& texto);
+    void escreverChar(char c);
+    // Sem largura: igual a cout << valor
+    void escreverInteiro(long long valor);
+    // Com largura: igual a cout << setfill('0') << setw(largura) << valor,
+    // inclusive para negativos (-1 com largura 3 vira "0-1")
+    void escreverInteiro(long long valor, int largura);
+    void novaLinha();
+
+    // Envia o conteúdo do buffer para o descritor
+    void descarregar();
+    void setDescritor(int novoFd);
+    int getDescritor() const;
+
+    // Texto ainda no buffer (todo o texto escrito, no modo MEMORIA)
+    const char* getDados() const { return buffer; }
+    size_t getUsado() const { return usado; }
+    // Descarta o texto no buffer sem escrevê-lo
+    void limpar() { usado = 0; }
+};
+
+#endif
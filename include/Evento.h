@@ -2,33 +2,71 @@
 #define EVENTO_H
 #include <string>
 
+class TabelaNomes;
+class EscritorSaida;
+
 enum TipoEvento {
     RG, AR, RM, UR, TR, EN
 };
 
 // Representa um evento do sistema de logística.
 // Contém informações como tempo, tipo, IDs, remetente e destinatário.
+// Só tem campos inteiros (os nomes são IDs da TabelaNomes), então é
+// trivialmente copiável: copiar um evento é copiar 40 bytes.
 class Evento {
 public:
-
-
+    long long sequencia; // Ordem de chegada, atribuída pelo Simulador ao registrar o evento
+    int tempo;
     int idPacote;
     int armazemOrigem;
     int armazemDestino;
     int secaoDestino;
-    int tempo;
+    int remetente;    // ID do nome na TabelaNomes, -1 se não se aplica
+    int destinatario; // ID do nome na TabelaNomes, -1 se não se aplica
     TipoEvento tipo;
-    std::string remetente;
-    std::string destinatario;
-    Evento(const Evento& ev);
+
     Evento(int tempo, TipoEvento tipo, int idPacote,
-          const std::string& remetente = "", const std::string& destinatario = "",
+          int remetente = -1, int destinatario = -1,
           int armazemOrigem = -1, int armazemDestino = -1,
           int secaoDestino = -1);
     static TipoEvento lerTipo(const std::string& tipoStr);
-    static Evento lerEvento(const std::string& linha);
+    // Os nomes do evento RG são internados na tabela informada
+    static Evento lerEvento(const std::string& linha, TabelaNomes& nomes);
 };
 
-int gerarChaveEvento(const Evento& ev);
+// Uma versão do estado é o número de eventos aplicados até ela: na versão v
+// só existem os eventos com sequencia < v. VERSAO_ATUAL enxerga todos.
+const long long VERSAO_ATUAL = 0x7fffffffffffffffLL;
+
+// Chave de ordenação dos eventos: (tempo, idPacote, tipo, sequência).
+// A sequência de chegada desempata eventos com os mesmos campos, então duas
+// chaves só são iguais quando se referem ao mesmo evento.
+struct ChaveEvento {
+    int tempo;
+    int idPacote;
+    int tipo;
+    long long sequencia;
+
+    bool operator<(const ChaveEvento& outra) const {
+        if (tempo != outra.tempo) return tempo < outra.tempo;
+        if (idPacote != outra.idPacote) return idPacote < outra.idPacote;
+        if (tipo != outra.tipo) return tipo < outra.tipo;
+        return sequencia < outra.sequencia;
+    }
+    bool operator>(const ChaveEvento& outra) const { return outra < *this; }
+    bool operator==(const ChaveEvento& outra) const {
+        return tempo == outra.tempo && idPacote == outra.idPacote &&
+               tipo == outra.tipo && sequencia == outra.sequencia;
+    }
+    bool operator!=(const ChaveEvento& outra) const { return !(*this == outra); }
+};
+
+ChaveEvento gerarChaveEvento(const Evento& ev);
+
+// Escreve o evento no formato da entrada (uma linha), resolvendo os nomes na tabela
+void escreverEvento(EscritorSaida& saida, const Evento& ev, const TabelaNomes& nomes);
+// Mesma coisa com os nomes já resolvidos (usados só no RG)
+void escreverEvento(EscritorSaida& saida, const Evento& ev, const std::string* remetente,
+                    const std::string* destinatario);
 
 #endif
\ No newline at end of file
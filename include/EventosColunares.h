@@ -0,0 +1,95 @@
+#ifndef EVENTOS_COLUNARES_H
+#define EVENTOS_COLUNARES_H
+
+#include "Evento.h"
+
+// Armazenamento alternativo à ArvoreEventos: os campos que as buscas leem
+// (tempo, origem e destino) ficam em colunas, todas na mesma ordem de
+// chave, ao lado do ponteiro para o evento completo. Varreduras por
+// intervalo de tempo viram leituras sequenciais de poucos vetores de int,
+// feitas pelos kernels SIMD de KernelsSimd.h. A consulta MA não varre as
+// colunas: lê a fatia do armazém em IndiceArmazens, mantido nos dois modos.
+//
+// Como a entrada quase sempre chega em ordem de tempo, inserir() só anexa a
+// linha ao fim das colunas. Um evento atrasado vai para um run lateral
+// pequeno e ordenado, que as buscas consultam junto com as colunas; ele só
+// é mesclado às colunas (uma passada de trás para frente) quando passa de
+// limiteAtrasados(), da ordem da raiz do número de linhas. Assim cada
+// atrasado custa O(raiz de n) amortizado, intercalado ou não com consultas.
+//
+// Um índice esparso guarda o tempo da primeira linha de cada bloco de
+// LINHAS_POR_BLOCO linhas; a busca por tempo faz uma busca binária nesse
+// índice (pequeno, cabe no cache) e depois varre um único bloco.
+class EventosColunares {
+private:
+    static const int LINHAS_POR_BLOCO = 64;
+    static const int MINIMO_ATRASADOS = 256;
+
+    int* tempos;
+    int* origens;
+    int* destinos;
+    Evento** eventos; // Evento completo de cada linha, para imprimir
+    int tamanho;
+    int capacidade;
+
+    // Índice esparso: tempo da primeira linha de cada bloco. Só é válido até
+    // blocosValidos; inserções no meio invalidam o resto, refeito sob demanda.
+    int* indiceTempos;
+    int capacidadeIndice;
+    mutable int blocosValidos;
+
+    Evento** atrasados; // Run lateral: eventos fora de ordem, ordenados pela chave
+    int totalAtrasados;
+    int capacidadeAtrasados;
+
+    void crescer();
+    void escreverLinha(int linha, Evento* ev);
+    void moverLinha(int origem, int destino);
+    void atualizarIndice() const;
+    int limiteAtrasados() const;
+
+public:
+    EventosColunares();
+    ~EventosColunares();
+
+    EventosColunares(const EventosColunares&) = delete;
+    EventosColunares& operator=(const EventosColunares&) = delete;
+
+    // Anexa o evento, ou o guarda no run lateral se chegou fora de ordem
+    void inserir(Evento* ev);
+    // Leva o run lateral para as colunas
+    void mesclarAtrasados();
+    // Completa o índice. Deve ser chamado depois da última inserção e antes
+    // das buscas abaixo, que então só leem as colunas e o run lateral e
+    // podem rodar em várias threads ao mesmo tempo.
+    void prepararLeitura();
+    int getTamanho() const; // Inclui os atrasados ainda no run lateral
+    // Preenche um armazenamento vazio com total linhas já em ordem de chave
+    // (snapshot): o evento da linha i é base + indices[i], e as colunas saem
+    // dele. O índice esparso é refeito em prepararLeitura().
+    void restaurar(int total, const int* indices, Evento* base);
+
+    // Primeira linha com tempo >= tempo (ou > tempo, no caso do superior).
+    // As linhas retornadas valem para os acessores abaixo até a próxima inserção.
+    int limiteInferior(int tempo) const;
+    int limiteSuperior(int tempo) const;
+    // Quantas linhas em [inicio, fim) têm o armazém como origem ou destino,
+    // e quais são (linhas precisa de espaço para fim - inicio posições)
+    int contarArmazem(int inicio, int fim, int idArmazem) const;
+    int filtrarArmazem(int inicio, int fim, int idArmazem, int* linhas) const;
+
+    const int* getTempos() const { return tempos; }
+    const int* getOrigens() const { return origens; }
+    const int* getDestinos() const { return destinos; }
+    Evento* getEvento(int linha) const { return eventos[linha]; }
+
+    // O run lateral, que completa as colunas: as buscas por intervalo
+    // precisam intercalar os dois pela chave do evento. As posições vão de
+    // 0 a getTotalAtrasados() e valem até a próxima inserção.
+    int atrasadosInferior(int tempo) const;
+    int atrasadosSuperior(int tempo) const;
+    int getTotalAtrasados() const { return totalAtrasados; }
+    Evento* getAtrasado(int posicao) const { return atrasados[posicao]; }
+};
+
+#endif
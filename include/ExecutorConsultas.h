@@ -0,0 +1,78 @@
+#ifndef EXECUTOR_CONSULTAS_H
+#define EXECUTOR_CONSULTAS_H
+
+#include "Consulta.h"
+#include "EscritorSaida.h"
+#include "Instrumentacao.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class Simulador;
+
+// Responde lotes de consultas em paralelo. Cada consulta guarda a versão do
+// estado em que apareceu na entrada (o número de eventos aplicados antes
+// dela); como os índices só recebem inserções, responder na versão v é
+// ignorar os eventos com sequencia >= v. A carga alterna duas fases:
+//   1. aplica os eventos de um trecho da entrada e enfileira as consultas;
+//   2. com os índices congelados, as threads respondem às consultas, cada
+//      uma no buffer da sua tarefa, e os buffers vão para a saída na ordem
+//      da entrada.
+// As threads auxiliares são criadas uma vez e esperam o próximo lote.
+class ExecutorConsultas {
+private:
+    struct Tarefa {
+        Consulta consulta;
+        long long versao;
+        bool pronta; // Respondida já na fase 1 (ver responderAgora)
+        EscritorSaida texto;
+
+        Tarefa() : versao(0), pronta(false), texto(EscritorSaida::MEMORIA, 256) {}
+    };
+
+    const Simulador& simulador;
+    Tarefa* tarefas;
+    int capacidade;
+    int total;
+
+    std::thread* auxiliares;
+    int totalAuxiliares;
+    std::mutex trava;
+    std::condition_variable lotePublicado;
+    std::condition_variable loteConcluido;
+    long long geracao;   // Número do lote publicado
+    int concluidas;      // Auxiliares que já terminaram o lote atual
+    bool encerrar;
+    std::atomic<int> proxima; // Próxima tarefa a ser pega
+    std::string falha;   // Primeira exceção lançada por uma tarefa
+    // Uma por thread (0 = quem chama concluir()), juntadas à do Simulador
+    // no fim de cada lote, se ele tiver uma ligada
+    Instrumentacao* medidas;
+
+    void esperarLotes(int indice);
+    void responderPendentes(int indice);
+
+public:
+    // threads conta também a thread que chama concluir(), que ajuda no lote
+    ExecutorConsultas(const Simulador& simulador, int threads, int capacidade = 1024);
+    ~ExecutorConsultas();
+
+    ExecutorConsultas(const ExecutorConsultas&) = delete;
+    ExecutorConsultas& operator=(const ExecutorConsultas&) = delete;
+
+    bool cheio() const { return total == capacidade; }
+    int getTotal() const { return total; }
+
+    // Enfileira a consulta para ser respondida na versão dada, na fase 2
+    void adiar(const Consulta& consulta, long long versao);
+    // Reserva a próxima posição da saída para uma resposta dada já na fase 1;
+    // o chamador escreve a resposta no escritor retornado
+    EscritorSaida& responderAgora();
+    // Fase 2: responde às consultas adiadas e escreve as respostas em ordem.
+    // Lança runtime_error se alguma resposta falhou.
+    void concluir(EscritorSaida& saida);
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef FATIA_H
+#define FATIA_H
+
+#include <string>
+#include <cstring>
+
+// Trecho de texto que aponta para dentro de um buffer de entrada.
+// Não é dono dos dados, então não aloca nada; o buffer precisa continuar vivo.
+struct Fatia {
+    const char* inicio;
+    int tamanho;
+
+    Fatia() : inicio(nullptr), tamanho(0) {}
+    Fatia(const char* inicio, int tamanho) : inicio(inicio), tamanho(tamanho) {}
+
+    bool vazia() const { return tamanho == 0; }
+    bool igual(const char* texto) const {
+        return (int)strlen(texto) == tamanho && memcmp(inicio, texto, tamanho) == 0;
+    }
+    std::string str() const { return std::string(inicio, tamanho); }
+};
+
+#endif
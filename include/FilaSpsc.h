@@ -0,0 +1,111 @@
+#ifndef FILA_SPSC_H
+#define FILA_SPSC_H
+
+#include <atomic>
+#include <cstddef>
+#include <chrono>
+#include <thread>
+
+// Fila circular sem travas para exatamente um produtor e um consumidor.
+// Cada lado só escreve no seu próprio índice (cauda para o produtor, cabeça
+// para o consumidor) e lê o do outro com acquire, então não há mutex.
+// Quando a fila está cheia (ou vazia), inserir() (ou remover()) cede a CPU
+// até o outro lado andar; o tempo gasto esperando fica registrado.
+//
+// O produtor também amostra a ocupação a cada inserção, para mostrar qual
+// etapa do pipeline está acumulando trabalho.
+template <typename T>
+class FilaSpsc {
+private:
+    // Preenchimento para que cabeça e cauda fiquem em linhas de cache separadas
+    static const size_t LINHA_CACHE = 64;
+
+    T* itens;
+    size_t mascara; // capacidade - 1 (capacidade é potência de 2)
+
+    char separador1[LINHA_CACHE];
+    std::atomic<size_t> cabeca; // Próxima posição a ler (só o consumidor escreve)
+    char separador2[LINHA_CACHE];
+    std::atomic<size_t> cauda;  // Próxima posição a escrever (só o produtor escreve)
+    char separador3[LINHA_CACHE];
+
+    // Estatísticas do produtor
+    long long insercoes;
+    long long somaOcupacao;
+    size_t maximaOcupacao;
+    double segundosCheia;
+    // Estatísticas do consumidor
+    double segundosVazia;
+
+    static double agora() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+public:
+    explicit FilaSpsc(size_t capacidadeMinima)
+        : cabeca(0), cauda(0), insercoes(0), somaOcupacao(0), maximaOcupacao(0),
+          segundosCheia(0), segundosVazia(0) {
+        size_t capacidade = 2;
+        while (capacidade < capacidadeMinima) capacidade *= 2;
+        itens = new T[capacidade];
+        mascara = capacidade - 1;
+        (void)separador1;
+        (void)separador2;
+        (void)separador3;
+    }
+
+    ~FilaSpsc() {
+        delete[] itens;
+    }
+
+    FilaSpsc(const FilaSpsc&) = delete;
+    FilaSpsc& operator=(const FilaSpsc&) = delete;
+
+    // Produtor: retorna false se a fila estiver cheia
+    bool tentarInserir(const T& item) {
+        size_t fim = cauda.load(std::memory_order_relaxed);
+        size_t ocupacao = fim - cabeca.load(std::memory_order_acquire);
+        if (ocupacao > mascara) return false;
+
+        itens[fim & mascara] = item;
+        cauda.store(fim + 1, std::memory_order_release);
+
+        insercoes++;
+        somaOcupacao += ocupacao + 1;
+        if (ocupacao + 1 > maximaOcupacao) maximaOcupacao = ocupacao + 1;
+        return true;
+    }
+
+    // Consumidor: retorna false se a fila estiver vazia
+    bool tentarRemover(T& item) {
+        size_t inicio = cabeca.load(std::memory_order_relaxed);
+        if (inicio == cauda.load(std::memory_order_acquire)) return false;
+
+        item = itens[inicio & mascara];
+        cabeca.store(inicio + 1, std::memory_order_release);
+        return true;
+    }
+
+    void inserir(const T& item) {
+        if (tentarInserir(item)) return;
+        double inicio = agora();
+        while (!tentarInserir(item)) std::this_thread::yield();
+        segundosCheia += agora() - inicio;
+    }
+
+    void remover(T& item) {
+        if (tentarRemover(item)) return;
+        double inicio = agora();
+        while (!tentarRemover(item)) std::this_thread::yield();
+        segundosVazia += agora() - inicio;
+    }
+
+    size_t getCapacidade() const { return mascara + 1; }
+    long long getInsercoes() const { return insercoes; }
+    size_t getMaximaOcupacao() const { return maximaOcupacao; }
+    double getOcupacaoMedia() const { return insercoes ? static_cast<double>(somaOcupacao) / insercoes : 0; }
+    double getSegundosCheia() const { return segundosCheia; }
+    double getSegundosVazia() const { return segundosVazia; }
+};
+
+#endif
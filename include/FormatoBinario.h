@@ -0,0 +1,100 @@
+#ifndef FORMATO_BINARIO_H
+#define FORMATO_BINARIO_H
+
+#include "EscritorSaida.h"
+#include "Fatia.h"
+#include "LeitorEntrada.h"
+#include "TabelaNomes.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Base dos arquivos binários (snapshot e log de entrada). Layout, com os
+// inteiros na ordem nativa (little-endian):
+//   CabecalhoBinario
+//   nomes:     para cada ID, em ordem: uint32 tamanho + bytes, com zeros
+//              no fim até múltiplo de 8
+//   registros: totalRegistros registros de tamanhoRegistro bytes, ou, com
+//              tamanhoRegistro = REGISTRO_VARIAVEL, uma sequência de bytes
+//              até o fim do arquivo, que o próprio formato sabe percorrer
+// Cada formato tem sua assinatura, sua versão e seu tipo de registro.
+struct CabecalhoBinario {
+    char magica[8];
+    uint32_t versaoFormato;
+    uint32_t tamanhoRegistro; // Para detectar layouts diferentes
+    uint64_t totalNomes;
+    uint64_t bytesNomes;      // Inclui o preenchimento
+    uint64_t totalRegistros;
+    uint32_t crcNomes;
+    uint32_t crcRegistros;
+    uint32_t crcCabecalho;    // Dos campos acima
+    uint32_t reservado;
+};
+
+// tamanhoRegistro dos formatos com registros de tamanho variável
+const uint32_t REGISTRO_VARIAVEL = 0;
+
+// Grava num arquivo temporário, renomeado só em concluir(), para que um
+// arquivo pela metade nunca substitua um válido. Ordem das chamadas:
+// escreverNomes() uma vez, escreverRegistro() para cada registro, concluir().
+class GravadorBinario {
+private:
+    std::string nomeArquivo;
+    std::string temporario;
+    int fd;
+    EscritorSaida* escritor;
+    CabecalhoBinario cabecalho;
+    uint64_t bytesRegistros;
+    bool concluido;
+
+public:
+    GravadorBinario(const std::string& nomeArquivo, const char magica[8],
+                    uint32_t versaoFormato, uint32_t tamanhoRegistro);
+    // Sem concluir(), apaga o temporário
+    ~GravadorBinario();
+
+    GravadorBinario(const GravadorBinario&) = delete;
+    GravadorBinario& operator=(const GravadorBinario&) = delete;
+
+    void escreverNomes(const TabelaNomes& nomes);
+    void escreverRegistro(const void* registro);
+    // Com REGISTRO_VARIAVEL: cada registro diz o próprio tamanho
+    void escreverRegistro(const void* registro, size_t tamanho);
+    void concluir();
+    // Bytes do arquivo até aqui, cabeçalho incluído
+    uint64_t getTamanho() const;
+};
+
+// Mapeia o arquivo e confere assinatura, versão, tamanhos e checksums no
+// construtor, lançando runtime_error se algo não bater.
+class LeitorBinario {
+private:
+    ArquivoMapeado arquivo;
+    const CabecalhoBinario* cabecalho;
+    const char* registros;
+    const char** inicioNomes; // Início (campo de tamanho) de cada nome
+
+public:
+    // descricao aparece nas mensagens de erro ("Snapshot", "Log binario"...)
+    LeitorBinario(const std::string& nomeArquivo, const char magica[8], uint32_t versaoFormato,
+                  uint32_t tamanhoRegistro, const char* descricao);
+    ~LeitorBinario();
+
+    LeitorBinario(const LeitorBinario&) = delete;
+    LeitorBinario& operator=(const LeitorBinario&) = delete;
+
+    long long getTotalNomes() const { return static_cast<long long>(cabecalho->totalNomes); }
+    long long getTotalRegistros() const { return static_cast<long long>(cabecalho->totalRegistros); }
+    // O texto aponta para dentro do mapa
+    Fatia getNome(long long id) const;
+    const void* getRegistro(long long i) const { return registros + i * cabecalho->tamanhoRegistro; }
+    // A seção inteira; é o único acesso com REGISTRO_VARIAVEL
+    const char* getInicioRegistros() const { return registros; }
+    const char* getFimRegistros() const { return arquivo.getFim(); }
+    size_t getTamanho() const { return arquivo.getTamanho(); }
+
+    // Diz se o buffer começa com a assinatura dada
+    static bool reconhecer(const char* inicio, size_t tamanho, const char magica[8]);
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef HISTOGRAMA_LATENCIA_H
+#define HISTOGRAMA_LATENCIA_H
+
+#include <ostream>
+
+// Histograma de latências em nanossegundos com memória fixa: cada potência
+// de 2 é dividida em SUBDIVISOES faixas iguais, então um percentil sai com
+// erro relativo de no máximo 1/SUBDIVISOES, sem guardar as amostras.
+class HistogramaLatencia {
+private:
+    static const int SUBDIVISOES = 16;
+    static const int POTENCIAS = 48; // Até 2^48 ns, mais de 3 dias
+    static const int FAIXAS = POTENCIAS * SUBDIVISOES;
+
+    long long contagens[FAIXAS];
+    long long total;
+    long long maximo;
+    double soma;
+
+    static int faixa(long long nanossegundos);
+    static long long limiteSuperior(int faixa);
+
+public:
+    HistogramaLatencia();
+
+    void registrar(long long nanossegundos);
+    // Soma as amostras de outro histograma a este
+    void juntar(const HistogramaLatencia& outro);
+
+    long long getTotal() const { return total; }
+    long long getMaximo() const { return maximo; }
+    double getMedia() const { return total ? soma / total : 0; }
+    // Limite superior da faixa que contém o percentil p (entre 0 e 100)
+    long long percentil(double p) const;
+
+    // "rotulo: n amostras, media ..., p50 ..., p99 ..., max ..." em microssegundos
+    void imprimir(std::ostream& saida, const char* rotulo) const;
+};
+
+#endif
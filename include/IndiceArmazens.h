@@ -0,0 +1,48 @@
+#ifndef INDICE_ARMAZENS_H
+#define INDICE_ARMAZENS_H
+
+#include "Evento.h"
+#include "VetorEventos.h"
+
+// Índice secundário (armazém, tempo) usado pela consulta MA.
+// Cada armazém tem seu próprio VetorEventos ordenado por chave, contendo os
+// eventos em que ele aparece como origem ou destino. Os armazéns são
+// endereçados diretamente pelo ID (IDs pequenos e densos, com -1 para
+// "campo ausente").
+//
+// Como em EventosColunares, um evento que chega fora de ordem não desloca o
+// vetor do armazém: vai para um run lateral ordenado do próprio armazém, que
+// só é mesclado quando passa da ordem da raiz do tamanho do vetor. A
+// consulta intercala os dois pela chave.
+class IndiceArmazens {
+private:
+    static const int MINIMO_ATRASADOS = 64;
+
+    struct EventosArmazem {
+        VetorEventos eventos;
+        VetorEventos atrasados; // Fora de ordem, ainda não mesclados
+    };
+
+    EventosArmazem** armazens; // posição = id + 1
+    int capacidade;
+
+    void garantirCapacidade(int posicao);
+    void indexar(int idArmazem, Evento* ev);
+    static int limiteAtrasados(int tamanho);
+
+public:
+    IndiceArmazens();
+    ~IndiceArmazens();
+
+    IndiceArmazens(const IndiceArmazens&) = delete;
+    IndiceArmazens& operator=(const IndiceArmazens&) = delete;
+
+    void inserir(Evento* ev);
+    // Retorna os eventos do armazém, ou nullptr se ele nunca apareceu.
+    // getAtrasados() completa getEventos() (os dois em ordem de chave); os
+    // vetores valem até a próxima inserção.
+    const VetorEventos* getEventos(int idArmazem) const;
+    const VetorEventos* getAtrasados(int idArmazem) const;
+};
+
+#endif
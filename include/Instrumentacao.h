@@ -0,0 +1,97 @@
+#ifndef INSTRUMENTACAO_H
+#define INSTRUMENTACAO_H
+
+#include "HistogramaLatencia.h"
+#include <chrono>
+#include <ostream>
+
+// Instrumentação opcional do Simulador: tempo de interpretação das linhas,
+// de cada etapa de processarEvento e de cada tipo de consulta, contagem de
+// eventos por tipo e de alocações (operator new). Uma instância só é
+// escrita por uma thread; as threads auxiliares medem na sua e o resultado
+// é juntado pela thread que aplica os eventos.
+//
+// Só existe quando compilado com -DTP3_ESTATISTICAS (make ESTATISTICAS=1);
+// sem a macro, INSTRUMENTAR(...) some e o Simulador não mede nada. Com a
+// macro, cada medida ainda depende de uma Instrumentacao ter sido ligada ao
+// Simulador (--stats); sem ela, sobra só o teste do ponteiro.
+#ifdef TP3_ESTATISTICAS
+#define INSTRUMENTAR(codigo) codigo
+#else
+#define INSTRUMENTAR(codigo)
+#endif
+
+// Trechos medidos; as etapas de evento somam o tempo de processarEvento
+enum EtapaMedida {
+    ETAPA_INTERPRETAR,        // Texto (ou registro binário) -> LinhaEntrada
+    ETAPA_EVENTO_PACOTE,      // Busca ou criação do pacote
+    ETAPA_EVENTO_INDICE,      // Índices globais de eventos (colunas ou AVL + armazéns)
+    ETAPA_EVENTO_HISTORICO,   // Histórico, primeiro e último evento do pacote
+    ETAPA_EVENTO_CLIENTES,    // RG: remetente e destinatário
+    ETAPA_EVENTO_ROTAS,       // TR: contagem de congestionamento
+    ETAPA_CONSULTA_PC,        // Na ordem de TipoConsulta
+    ETAPA_CONSULTA_CL,
+    ETAPA_CONSULTA_MA,
+    ETAPA_CONSULTA_RC,
+    TOTAL_ETAPAS
+};
+
+class Instrumentacao {
+private:
+    static const int TIPOS_EVENTO = 6;
+
+    HistogramaLatencia etapas[TOTAL_ETAPAS];
+    long long eventosPorTipo[TIPOS_EVENTO];
+    long long consultasInvalidas;
+
+public:
+    Instrumentacao();
+
+    void registrar(EtapaMedida etapa, long long nanossegundos) { etapas[etapa].registrar(nanossegundos); }
+    void contarEvento(int tipo) { eventosPorTipo[tipo]++; }
+    void contarConsultaInvalida() { consultasInvalidas++; }
+    const HistogramaLatencia& getEtapa(EtapaMedida etapa) const { return etapas[etapa]; }
+    // Soma a esta as medidas feitas em outra thread (lotes de leitura,
+    // threads de consultas), que mede numa instrumentação própria
+    void juntar(const Instrumentacao& outra);
+    void juntar(EtapaMedida etapa, const HistogramaLatencia& medidas) { etapas[etapa].juntar(medidas); }
+
+    // false se o programa foi compilado sem TP3_ESTATISTICAS
+    static bool disponivel();
+    // Chamadas a operator new/delete e bytes pedidos desde o início do programa
+    // (zero sem TP3_ESTATISTICAS, quando operator new não é substituído)
+    static long long getAlocacoes();
+    static long long getLiberacoes();
+    static long long getBytesAlocados();
+
+    // Uma linha por etapa (em ns), eventos por tipo e alocações
+    void imprimir(std::ostream& saida) const;
+};
+
+// Mede trechos consecutivos: cada marcar() registra o tempo desde a marca
+// anterior (ou desde a construção) na etapa dada. Com instrumentacao nula,
+// não lê o relógio.
+class Cronometro {
+private:
+    Instrumentacao* instrumentacao;
+    std::chrono::steady_clock::time_point anterior;
+
+public:
+    explicit Cronometro(Instrumentacao* instrumentacao) : instrumentacao(instrumentacao) {
+        if (instrumentacao) anterior = std::chrono::steady_clock::now();
+    }
+
+    void marcar(EtapaMedida etapa) {
+        if (!instrumentacao) return;
+        std::chrono::steady_clock::time_point agora = std::chrono::steady_clock::now();
+        instrumentacao->registrar(etapa, std::chrono::duration_cast<std::chrono::nanoseconds>(agora - anterior).count());
+        anterior = agora;
+    }
+
+    // Recomeça a contagem sem registrar o trecho anterior
+    void reiniciar() {
+        if (instrumentacao) anterior = std::chrono::steady_clock::now();
+    }
+};
+
+#endif
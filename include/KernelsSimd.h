@@ -0,0 +1,32 @@
+#ifndef KERNELS_SIMD_H
+#define KERNELS_SIMD_H
+
+// Laços de varredura sobre colunas de int usados pelo armazenamento colunar.
+// Cada função tem uma versão escalar e, em x86, versões SSE2 e AVX2; a melhor
+// suportada pela CPU é escolhida em tempo de execução, sem exigir flags de
+// compilação específicas.
+
+enum NivelSimd {
+    SIMD_ESCALAR,
+    SIMD_SSE2,
+    SIMD_AVX2
+};
+
+// Maior nível suportado pela CPU atual
+NivelSimd detectarNivelSimd();
+// Força um nível (limitado ao detectado); usado para comparar as versões
+void selecionarNivelSimd(NivelSimd nivel);
+NivelSimd getNivelSimd();
+const char* getNomeNivelSimd(NivelSimd nivel);
+
+// Quantas linhas têm o armazém como origem ou destino
+int contarArmazem(const int* origens, const int* destinos, int n, int idArmazem);
+// Escreve em indices as posições (0..n-1) dessas linhas, em ordem, e retorna
+// quantas são. indices precisa ter espaço para n posições.
+int filtrarArmazem(const int* origens, const int* destinos, int n, int idArmazem, int* indices);
+// Em valores ordenados, quantos são < limite (ou <= limite), ou seja, a
+// posição do limite inferior (ou superior) dentro do trecho.
+int contarMenores(const int* valores, int n, int limite);
+int contarMenoresOuIguais(const int* valores, int n, int limite);
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef LEITOR_ENTRADA_H
+#define LEITOR_ENTRADA_H
+
+#include "Evento.h"
+#include "Consulta.h"
+#include "Fatia.h"
+#include <string>
+#include <cstddef>
+
+// Arquivo de entrada mapeado em memória (mmap), liberado no destrutor.
+// Se o arquivo não puder ser mapeado (ex.: um pipe), é lido para um buffer.
+class ArquivoMapeado {
+private:
+    char* dados;
+    size_t tamanho;
+    bool mapeado;
+
+public:
+    ArquivoMapeado(const std::string& nomeArquivo);
+    ~ArquivoMapeado();
+
+    ArquivoMapeado(const ArquivoMapeado&) = delete;
+    ArquivoMapeado& operator=(const ArquivoMapeado&) = delete;
+
+    const char* getInicio() const;
+    const char* getFim() const;
+    size_t getTamanho() const;
+};
+
+enum TipoLinha {
+    LINHA_IGNORADA, LINHA_EVENTO, LINHA_CONSULTA
+};
+
+// Resultado da interpretação de uma linha. Os nomes do evento RG apontam
+// para dentro do buffer de entrada, sem cópia.
+struct LinhaEntrada {
+    TipoLinha tipo;
+    Evento evento;
+    Fatia remetente;
+    Fatia destinatario;
+    Consulta consulta;
+
+    LinhaEntrada() : tipo(LINHA_IGNORADA), evento(0, RG, -1) {}
+};
+
+// Percorre um buffer de texto linha a linha, sem alocar strings.
+// Os campos numéricos (%.7ld, %.3d) são lidos por um conversor próprio.
+class LeitorEntrada {
+private:
+    const char* cursor;
+    const char* fim;
+    int numeroLinha;
+
+public:
+    LeitorEntrada(const char* inicio, const char* fim);
+
+    // Avança para a próxima linha não vazia; retorna false no fim da entrada
+    bool proximaLinha(Fatia& linha);
+    int getNumeroLinha() const;
+
+    // Interpreta uma linha; lança std::runtime_error se o evento for inválido
+    static void interpretar(const Fatia& linha, LinhaEntrada& saida);
+};
+
+#endif
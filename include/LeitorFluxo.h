@@ -0,0 +1,62 @@
+#ifndef LEITOR_FLUXO_H
+#define LEITOR_FLUXO_H
+
+#include "Fatia.h"
+#include "HistogramaLatencia.h"
+#include <cstddef>
+#include <ostream>
+
+// Lê linhas de um descritor que não pode ser mapeado (stdin, pipe, FIFO)
+// num buffer de tamanho fixo: a memória usada não depende do tamanho da
+// entrada. As linhas completas já no buffer saem sem bloquear; só ler()
+// espera por mais dados. Linhas vazias são puladas, como em LeitorEntrada.
+class LeitorFluxo {
+private:
+    int fd;
+    char* buffer;
+    size_t capacidade;
+    size_t inicio;     // Primeiro byte ainda não entregue
+    size_t usado;      // Bytes válidos no buffer
+    bool terminou;     // read() já indicou o fim do fluxo
+    bool descartando;  // Pulando o resto de uma linha maior que o buffer
+    int numeroLinha;
+    long long bytesLidos;
+
+public:
+    static const size_t CAPACIDADE_PADRAO = 1 << 20;
+
+    explicit LeitorFluxo(int fd, size_t capacidade = CAPACIDADE_PADRAO);
+    ~LeitorFluxo();
+
+    LeitorFluxo(const LeitorFluxo&) = delete;
+    LeitorFluxo& operator=(const LeitorFluxo&) = delete;
+
+    // Próxima linha não vazia já completa no buffer, sem bloquear. A fatia
+    // vale até a próxima chamada de ler(). Retorna false se não há nenhuma.
+    bool proximaLinha(Fatia& linha);
+    // Bloqueia até chegarem mais dados; retorna false se o fluxo já tinha
+    // terminado. Lança runtime_error se a leitura falhar (e o fluxo termina)
+    // ou se uma linha não couber no buffer (ela é descartada e a leitura
+    // pode continuar).
+    bool ler();
+
+    int getNumeroLinha() const { return numeroLinha; }
+    long long getBytesLidos() const { return bytesLidos; }
+};
+
+// Resultado de Simulador::carregarFluxo. A latência de uma consulta vai da
+// leitura que completou a sua linha até a resposta ser entregue ao descritor
+// de saída.
+struct EstatisticasFluxo {
+    long long linhas;
+    long long consultas;
+    long long bytes;
+    long long leituras;    // Chamadas a read(), inclusive a que viu o fim
+    double segundosTotal;
+    HistogramaLatencia latencias;
+
+    EstatisticasFluxo() : linhas(0), consultas(0), bytes(0), leituras(0), segundosTotal(0) {}
+    void imprimir(std::ostream& saida) const;
+};
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef LEITOR_PARALELO_H
+#define LEITOR_PARALELO_H
+
+#include "LeitorEntrada.h"
+#include "HistogramaLatencia.h"
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Linha que não pôde ser interpretada, com a mensagem da exceção
+struct ErroLinha {
+    int indice;       // Quantas linhas válidas do lote vêm antes dela
+    int numeroLinha;  // Relativo ao início do trecho
+    std::string mensagem;
+};
+
+// Linhas já interpretadas de um trecho da entrada, na ordem do arquivo.
+// Os lotes são reaproveitados entre trechos, sem liberar os vetores.
+class LoteLinhas {
+private:
+    LinhaEntrada* linhas;
+    int* numeros;     // Número de cada linha, relativo ao início do trecho
+    int totalLinhas;
+    int capacidadeLinhas;
+
+    ErroLinha* erros;
+    int totalErros;
+    int capacidadeErros;
+
+    int linhasLidas;  // Todas as linhas do trecho, inclusive vazias e ignoradas
+    HistogramaLatencia interpretacao; // Tempo de cada linha, com medir (ver Instrumentacao.h)
+
+public:
+    LoteLinhas();
+    ~LoteLinhas();
+
+    LoteLinhas(const LoteLinhas&) = delete;
+    LoteLinhas& operator=(const LoteLinhas&) = delete;
+
+    // Interpreta o trecho [inicio, fim), que termina numa quebra de linha.
+    // Com medir, o tempo de cada linha vai para getInterpretacao(), que quem
+    // aplica o lote junta à instrumentação do Simulador.
+    void interpretar(const char* inicio, const char* fim, bool medir = false);
+
+    int getTotalLinhas() const { return totalLinhas; }
+    const LinhaEntrada& getLinha(int i) const { return linhas[i]; }
+    int getNumeroLinha(int i) const { return numeros[i]; }
+    int getTotalErros() const { return totalErros; }
+    const ErroLinha& getErro(int i) const { return erros[i]; }
+    int getLinhasLidas() const { return linhasLidas; }
+    const HistogramaLatencia& getInterpretacao() const { return interpretacao; }
+};
+
+// Divide o buffer em trechos terminados em quebra de linha e os interpreta
+// em várias threads. proximoLote() devolve os lotes na ordem do arquivo,
+// enquanto as threads já interpretam os trechos seguintes; no máximo
+// 2 * threads lotes ficam prontos à espera de quem consome.
+class LeitorParalelo {
+private:
+    static const size_t TAMANHO_TRECHO = 1 << 20;
+
+    const char** inicioTrechos; // Trecho i = [inicioTrechos[i], inicioTrechos[i + 1])
+    int totalTrechos;
+
+    LoteLinhas* lotes;
+    int* trechoDoLote;  // Trecho já interpretado em cada lote, ou -1
+    int totalLotes;
+
+    std::thread* threads;
+    int totalThreads;
+    bool medir;         // Repassado a LoteLinhas::interpretar
+
+    std::mutex trava;
+    std::condition_variable loteLiberado;
+    std::condition_variable lotePronto;
+    int proximoTrecho;  // Próximo trecho a ser pego por uma thread
+    int consumidos;     // Trechos já devolvidos e liberados por quem consome
+    bool entregue;      // O lote do trecho consumidos está com quem consome
+
+    void trabalhar();
+
+public:
+    LeitorParalelo(const char* inicio, const char* fim, int numThreads, bool medir = false);
+    ~LeitorParalelo();
+
+    LeitorParalelo(const LeitorParalelo&) = delete;
+    LeitorParalelo& operator=(const LeitorParalelo&) = delete;
+
+    // Lote do próximo trecho (espera ficar pronto), ou nullptr no fim.
+    // O lote anterior é liberado para reuso nesta chamada.
+    const LoteLinhas* proximoLote();
+};
+
+#endif
@@ -4,17 +4,22 @@
 #include <iostream>
 #include <stdexcept>
 
-// Lista duplamente encadeada de inteiros
+// Lista duplamente encadeada de inteiros.
+// Cada nó guarda um bloco de até INTS_POR_NO valores, então enfileirar só
+// aloca memória uma vez a cada INTS_POR_NO inserções.
 class ListaInt
 {
 private:
+    static const int INTS_POR_NO = 14;
+
     struct No
     {
-        int dados;
+        int dados[INTS_POR_NO];
+        int usados;
         No *proximo;
         No *anterior;
 
-        No(int d) : dados(d), proximo(nullptr), anterior(nullptr) {}
+        No() : usados(0), proximo(nullptr), anterior(nullptr) {}
     };
 
     No *cabeca; // ponteiro para o primeiro nó
@@ -50,7 +55,8 @@ public:
         tamanho = 0;
         for (No *atual = outra.cabeca; atual != nullptr; atual = atual->proximo)
         {
-            enfileirar(atual->dados);
+            for (int i = 0; i < atual->usados; i++)
+                enfileirar(atual->dados[i]);
         }
     }
 
@@ -62,7 +68,8 @@ public:
             limpar();
             for (No *atual = outra.cabeca; atual != nullptr; atual = atual->proximo)
             {
-                enfileirar(atual->dados);
+                for (int i = 0; i < atual->usados; i++)
+                    enfileirar(atual->dados[i]);
             }
         }
         return *this;
@@ -71,17 +78,21 @@ public:
     // Adiciona elemento ao final da lista
     void enfileirar(int dados)
     {
-        No *novoNo = new No(dados);
-        if (!cabeca)
-        {
-            cabeca = cauda = novoNo;
-        }
-        else
+        if (!cauda || cauda->usados == INTS_POR_NO)
         {
-            cauda->proximo = novoNo;
-            novoNo->anterior = cauda;
-            cauda = novoNo;
+            No *novoNo = new No();
+            if (!cabeca)
+            {
+                cabeca = cauda = novoNo;
+            }
+            else
+            {
+                cauda->proximo = novoNo;
+                novoNo->anterior = cauda;
+                cauda = novoNo;
+            }
         }
+        cauda->dados[cauda->usados++] = dados;
         tamanho++;
     }
 
@@ -99,7 +110,8 @@ public:
         No *atual = cabeca;
         while (atual != nullptr)
         {
-            std::cout << atual->dados << " ";
+            for (int i = 0; i < atual->usados; i++)
+                std::cout << atual->dados[i] << " ";
             atual = atual->proximo;
         }
         std::cout << std::endl;
@@ -108,7 +120,7 @@ public:
     class Iterador
     {
     public:
-        Iterador(No *no) : atual(no) {}
+        Iterador(No *no) : atual(no), indice(0) {}
 
         bool eValido() const
         {
@@ -121,21 +133,23 @@ public:
             {
                 throw std::out_of_range("Tentativa de desreferenciar um iterador invalido.");
             }
-            return atual->dados;
+            return atual->dados[indice];
         }
 
-        // Avança para o próximo nó
+        // Avança para o próximo valor, passando ao próximo nó no fim do bloco
         Iterador &operator++()
         {
-            if (eValido())
+            if (eValido() && ++indice == atual->usados)
             {
                 atual = atual->proximo;
+                indice = 0;
             }
             return *this;
         }
 
     private:
         No *atual;
+        int indice;
     };
 
     // Retorna iterador para o início da lista
@@ -0,0 +1,91 @@
+#ifndef LOG_BINARIO_H
+#define LOG_BINARIO_H
+
+#include "FormatoBinario.h"
+#include "LeitorEntrada.h"
+#include "TabelaNomes.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Log binário de entrada: as mesmas linhas do arquivo texto, na mesma ordem,
+// no layout de FormatoBinario com registros de tamanho variável. Os nomes de
+// clientes (de RG e CL) ficam no dicionário da seção de nomes, e os
+// registros guardam os IDs. A leitura não precisa separar nem converter
+// campos de texto.
+//
+// Cada registro é compacto: um byte de tipo, o tempo como diferença para o
+// registro anterior e depois só os campos que o texto daquele tipo tem, todos
+// em varint (zigzag, para os que podem ser negativos). Um evento típico cabe
+// em 6 a 8 bytes, contra ~30 da linha de texto. Qualquer int que o texto
+// aceita é representável, então a conversão não perde eventos.
+//
+// Linhas com erro são avisadas e descartadas na conversão. Consultas com
+// campos faltando são gravadas só com o tipo, e respondidas como no texto.
+//
+// Campos gravados por tipo de registro (os demais são -1, como no texto):
+//   RG: idPacote, armazemOrigem, armazemDestino, remetente, destinatario
+//   AR: idPacote, armazemOrigem, armazemDestino, secaoDestino
+//   RM, UR, TR: idPacote, armazemOrigem, armazemDestino
+//   EN: idPacote, armazemDestino
+//   PC: idPacote          CL: remetente = nome do cliente
+//   MA: remetente = tempoInicio, destinatario = tempoFim, armazemOrigem = armazém
+//   RC: idPacote = limite (-1 = todas as rotas)
+extern const char MAGICA_LOG[8]; // "TP3LOG" e dois '\0'
+const uint32_t VERSAO_LOG = 2;
+const int TIPO_REGISTRO_CONSULTA = 16;   // tipo = TIPO_REGISTRO_CONSULTA + TipoConsulta
+const int TIPO_REGISTRO_INCOMPLETA = 24; // Consulta sem camposCompletos
+const int TAMANHO_MAXIMO_REGISTRO = 1 + 6 * 5; // Tipo e até seis varints de 32 bits
+
+// Um registro já expandido, com os campos do comentário acima
+struct RegistroLog {
+    int32_t tempo;
+    int32_t tipo; // TipoEvento, ou TIPO_REGISTRO_CONSULTA/INCOMPLETA + TipoConsulta
+    int32_t idPacote;
+    int32_t remetente;
+    int32_t destinatario;
+    int32_t armazemOrigem;
+    int32_t armazemDestino;
+    int32_t secaoDestino;
+};
+
+// Monta o registro de uma linha já interpretada, internando os nomes na
+// tabela dada
+void codificarRegistroLog(const LinhaEntrada& linha, TabelaNomes& nomes, RegistroLog& registro);
+// Caminho inverso: os nomes apontam para o dicionário do log. Lança
+// runtime_error se o registro for inválido.
+void decodificarRegistroLog(const RegistroLog& registro, const LeitorBinario& log, LinhaEntrada& linha);
+
+// Forma compacta do registro, com o tempo relativo a tempoAnterior. Retorna
+// quantos bytes (até TAMANHO_MAXIMO_REGISTRO) foram escritos em destino.
+size_t compactarRegistroLog(const RegistroLog& registro, int32_t tempoAnterior, unsigned char* destino);
+
+// Percorre em ordem os registros compactos de um log aberto. Lança
+// runtime_error se a seção terminar no meio de um registro ou não bater
+// com o total do cabeçalho; um registro assim não tem como ser pulado.
+class CursorLog {
+private:
+    const unsigned char* atual;
+    const unsigned char* fim;
+    long long restantes;
+    int32_t tempoAnterior;
+
+public:
+    explicit CursorLog(const LeitorBinario& log);
+    // false no fim do log
+    bool proximo(RegistroLog& registro);
+};
+
+struct ResumoConversao {
+    long long linhas;      // Linhas não vazias da entrada
+    long long registros;   // Gravados
+    long long descartadas; // Com erro
+    size_t bytesEntrada;
+    size_t bytesSaida;
+};
+
+// Converte um arquivo texto para o log binário. Avisos das linhas
+// descartadas vão para cerr, com o número da linha.
+ResumoConversao converterParaLogBinario(const std::string& entrada, const std::string& saida);
+
+#endif
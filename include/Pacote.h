@@ -2,6 +2,9 @@
 #define PACOTE_H
 
 #include "Evento.h"
+#include "VetorEventos.h"
+
+class Cliente;
 
 // Representa um pacote com identificador e eventos associados.
 class Pacote
@@ -10,15 +13,44 @@ private:
     int id;
     Evento *primeiroEvento;
     Evento *ultimoEvento;
+    VetorEventos historico; // Eventos do pacote, em ordem de chave
+
+    // Clientes (remetentes e destinatários, sem repetição) cujo resumo lista
+    // os eventos deste pacote. Quase sempre são no máximo dois.
+    Cliente *vinculados[2];
+    Cliente **vinculadosExtras;
+    int totalVinculados;
 
 public:
     Pacote(int id);
+    ~Pacote();
+
+    Pacote(const Pacote &) = delete;
+    Pacote &operator=(const Pacote &) = delete;
+
     int getId() const;
 
     void setPrimeiroEvento(Evento *ev);
-    void setUltimoEvento(Evento *ev);
+    // versaoMinima: versão mais antiga ainda consultável (ver ResumoCliente)
+    void setUltimoEvento(Evento *ev, long long versaoMinima = VERSAO_ATUAL);
     Evento *getPrimeiroEvento() const;
     Evento *getUltimoEvento() const;
+    // Último evento a chegar entre os de sequencia < versao (nullptr se nenhum)
+    Evento *getUltimoEventoNaVersao(long long versao) const;
+
+    void adicionarEvento(Evento *ev);
+    const VetorEventos &getHistorico() const;
+
+    // Liga o cliente ao pacote, registrando o primeiro e o último evento no
+    // resumo dele; a partir daí cada novo último evento também é registrado.
+    void vincularCliente(Cliente *cliente, long long versaoMinima = VERSAO_ATUAL);
+    int getTotalVinculados() const;
+    Cliente *getVinculado(int i) const;
+
+    // Refaz o estado salvo num snapshot (ver Snapshot.h) num pacote recém
+    // criado, sem tocar nos resumos dos clientes, que são restaurados à parte
+    void restaurar(Evento *primeiro, Evento *ultimo, Evento *const *historico, int totalHistorico,
+                   Cliente *const *vinculados, int totalVinculados);
 };
 
 #endif
\ No newline at end of file
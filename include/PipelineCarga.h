@@ -0,0 +1,93 @@
+#ifndef PIPELINE_CARGA_H
+#define PIPELINE_CARGA_H
+
+#include "FilaSpsc.h"
+#include "LeitorParalelo.h"
+#include "RespostaConsulta.h"
+#include <ostream>
+#include <string>
+
+class Simulador;
+
+struct EstatisticasEtapa {
+    const char* nome;
+    long long itens;          // Linhas interpretadas, linhas aplicadas ou respostas escritas
+    double segundosTotal;     // Do início ao fim da etapa
+    double segundosEsperando; // Bloqueada em filas cheias ou vazias
+};
+
+struct EstatisticasFila {
+    const char* nome;
+    size_t capacidade;
+    long long insercoes;
+    double ocupacaoMedia;     // Amostrada a cada inserção
+    size_t ocupacaoMaxima;
+};
+
+struct EstatisticasPipeline {
+    static const int ETAPAS = 3;
+    static const int FILAS = 3;
+
+    EstatisticasEtapa etapas[ETAPAS];
+    EstatisticasFila filas[FILAS];
+    double segundosTotal;
+
+    EstatisticasPipeline();
+    void imprimir(std::ostream& saida) const;
+};
+
+// Carga em três etapas, cada uma na sua thread, ligadas por filas SPSC:
+//   1. leitura:   interpreta trechos da entrada em lotes de linhas
+//   2. aplicação: aplica os eventos aos índices e avalia as consultas
+//   3. saída:     formata as respostas e as escreve
+// A etapa 2 é a única que toca nos índices e processa as linhas na ordem do
+// arquivo, então cada consulta vê exatamente os eventos anteriores a ela. As
+// respostas seguem para a etapa 3 como cabeçalhos e itens (ver RespostaConsulta).
+class PipelineCarga {
+private:
+    static const size_t TAMANHO_TRECHO = 1 << 16;
+    static const int TOTAL_LOTES = 8;
+
+    // Cabeçalho com total < 0: fim das respostas
+    static const int TOTAL_FIM = -1;
+
+    // Destino da etapa 2: repassa as respostas para as filas da etapa 3
+    class DestinoFilas : public DestinoResposta {
+    private:
+        PipelineCarga& pipeline;
+    public:
+        explicit DestinoFilas(PipelineCarga& pipeline) : pipeline(pipeline) {}
+        void iniciar(const CabecalhoResposta& cabecalho) override;
+        void adicionar(const ItemResposta& item) override;
+    };
+
+    Simulador& simulador;
+    DestinoResposta& formatador;
+
+    LoteLinhas lotes[TOTAL_LOTES];
+    FilaSpsc<LoteLinhas*> lotesLivres;  // Etapa 2 -> etapa 1
+    FilaSpsc<LoteLinhas*> lotesProntos; // Etapa 1 -> etapa 2 (nullptr = fim)
+    FilaSpsc<CabecalhoResposta> cabecalhos; // Etapa 2 -> etapa 3
+    FilaSpsc<ItemResposta> itens;           // Etapa 2 -> etapa 3
+
+    EstatisticasPipeline estatisticas;
+    bool falhaSaida;
+    std::string mensagemFalhaSaida;
+
+    void lerTrechos(const char* inicio, const char* fim);
+    void aplicarLotes();
+    void escreverRespostas();
+
+public:
+    // As respostas são escritas pelo formatador, sempre na thread da etapa 3
+    PipelineCarga(Simulador& simulador, DestinoResposta& formatador);
+
+    PipelineCarga(const PipelineCarga&) = delete;
+    PipelineCarga& operator=(const PipelineCarga&) = delete;
+
+    // Processa o buffer inteiro; lança runtime_error se a escrita falhar
+    void executar(const char* inicio, const char* fim);
+    const EstatisticasPipeline& getEstatisticas() const;
+};
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef POOL_OBJETOS_H
+#define POOL_OBJETOS_H
+
+#include <new>
+#include <utility>
+#include <type_traits>
+
+// Pool de objetos de um único tipo, alocados em blocos (slabs) que crescem
+// geometricamente até BLOCO_MAXIMO objetos. Cada criar() só avança um índice
+// dentro do bloco atual, e o destrutor libera a memória bloco a bloco.
+//
+// Objetos com destrutor não trivial (Pacote, Cliente...) vivem até o fim do
+// pool; apenas tipos triviais (nós de árvore) podem ser devolvidos com
+// liberar(), indo para uma lista de livres que é reaproveitada.
+template <typename T>
+class PoolObjetos {
+private:
+    static const int BLOCO_INICIAL = 16;
+    static const int BLOCO_MAXIMO = 4096;
+
+    union Slot {
+        Slot* proximoLivre;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type objeto;
+    };
+
+    struct Bloco {
+        Bloco* proximo;
+        int capacidade;
+        int usados;
+        Slot* slots;
+    };
+
+    Bloco* atual;      // Bloco em uso (o mais recente); os anteriores estão cheios
+    Slot* livres;      // Slots devolvidos por liberar()
+    int totalBlocos;
+    long long totalObjetos;
+
+    void* alocar() {
+        if (livres) {
+            Slot* slot = livres;
+            livres = slot->proximoLivre;
+            return slot;
+        }
+        if (!atual || atual->usados == atual->capacidade) {
+            novoBloco();
+        }
+        return &atual->slots[atual->usados++];
+    }
+
+    void novoBloco() {
+        int capacidade = atual ? atual->capacidade * 2 : BLOCO_INICIAL;
+        if (capacidade > BLOCO_MAXIMO) capacidade = BLOCO_MAXIMO;
+
+        Bloco* bloco = new Bloco;
+        bloco->slots = static_cast<Slot*>(::operator new(sizeof(Slot) * capacidade));
+        bloco->capacidade = capacidade;
+        bloco->usados = 0;
+        bloco->proximo = atual;
+        atual = bloco;
+        totalBlocos++;
+    }
+
+public:
+    PoolObjetos() : atual(nullptr), livres(nullptr), totalBlocos(0), totalObjetos(0) {}
+
+    ~PoolObjetos() {
+        while (atual) {
+            if (!std::is_trivially_destructible<T>::value) {
+                for (int i = 0; i < atual->usados; i++) {
+                    reinterpret_cast<T*>(&atual->slots[i])->~T();
+                }
+            }
+            Bloco* proximo = atual->proximo;
+            ::operator delete(atual->slots);
+            delete atual;
+            atual = proximo;
+        }
+    }
+
+    PoolObjetos(const PoolObjetos&) = delete;
+    PoolObjetos& operator=(const PoolObjetos&) = delete;
+
+    template <typename... Args>
+    T* criar(Args&&... args) {
+        void* memoria = alocar();
+        totalObjetos++;
+        return new (memoria) T(std::forward<Args>(args)...);
+    }
+
+    // Reserva quantidade objetos consecutivos num bloco próprio, sem
+    // construí-los: o chamador preenche a memória (cópia em bloco de um
+    // snapshot, por exemplo). Só para tipos trivialmente copiáveis.
+    T* reservarContiguos(int quantidade) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "reservarContiguos() so pode ser usado com tipos trivialmente copiaveis");
+        static_assert(sizeof(Slot) == sizeof(T), "os slots precisam ter o tamanho do objeto");
+        if (quantidade <= 0) return nullptr;
+        Bloco* bloco = new Bloco;
+        bloco->slots = static_cast<Slot*>(::operator new(sizeof(Slot) * quantidade));
+        bloco->capacidade = quantidade;
+        bloco->usados = quantidade;
+        bloco->proximo = atual;
+        atual = bloco;
+        totalBlocos++;
+        totalObjetos += quantidade;
+        return reinterpret_cast<T*>(bloco->slots);
+    }
+
+    // Devolve um objeto ao pool para ser reaproveitado
+    void liberar(T* objeto) {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "liberar() so pode ser usado com tipos de destrutor trivial");
+        Slot* slot = reinterpret_cast<Slot*>(objeto);
+        slot->proximoLivre = livres;
+        livres = slot;
+        totalObjetos--;
+    }
+
+    // Visita todos os objetos criados, do bloco mais novo ao mais antigo.
+    // Só serve para pools em que nada foi devolvido com liberar().
+    template <typename Funcao>
+    void paraCada(Funcao visitar) const {
+        for (Bloco* bloco = atual; bloco; bloco = bloco->proximo) {
+            for (int i = 0; i < bloco->usados; i++) {
+                visitar(reinterpret_cast<T*>(&bloco->slots[i]));
+            }
+        }
+    }
+
+    int getTotalBlocos() const { return totalBlocos; }
+    long long getTotalObjetos() const { return totalObjetos; }
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef RESPOSTA_CONSULTA_H
+#define RESPOSTA_CONSULTA_H
+
+#include "Consulta.h"
+#include "Evento.h"
+#include "EscritorSaida.h"
+#include <string>
+
+// A resposta de uma consulta é produzida em duas partes: o cabeçalho (a
+// consulta e quantos itens seguem) e os itens (eventos ou rotas). Quem avalia
+// a consulta só lê os índices; quem formata só lê os itens. Assim as duas
+// etapas podem rodar em threads diferentes (ver PipelineCarga).
+struct CabecalhoResposta {
+    Consulta consulta;
+    bool valida; // false: consulta malformada, só "tempo tipo" é escrito
+    int total;   // Itens que seguem o cabeçalho
+};
+
+// Um evento (com os nomes já resolvidos, pois as strings da TabelaNomes
+// nunca mudam de endereço) ou uma rota da consulta RC
+struct ItemResposta {
+    const Evento* evento; // nullptr para rotas
+    const std::string* remetente;
+    const std::string* destinatario;
+    int origem;
+    int destino;
+    int contagem;
+};
+
+// Recebe as respostas na ordem em que as consultas são avaliadas
+class DestinoResposta {
+public:
+    virtual ~DestinoResposta() {}
+    virtual void iniciar(const CabecalhoResposta& cabecalho) = 0;
+    virtual void adicionar(const ItemResposta& item) = 0;
+};
+
+// Escreve as respostas no formato de saída do simulador
+class FormatadorResposta : public DestinoResposta {
+private:
+    EscritorSaida& saida;
+
+public:
+    explicit FormatadorResposta(EscritorSaida& saida);
+    void iniciar(const CabecalhoResposta& cabecalho) override;
+    void adicionar(const ItemResposta& item) override;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef RESUMO_CLIENTE_H
+#define RESUMO_CLIENTE_H
+
+#include "Evento.h"
+#include "Pacote.h"
+
+// Visão, em ordem de chave, do primeiro e do último evento de cada pacote
+// ligado a um cliente (como remetente ou destinatário). É atualizada a cada
+// evento: o novo último evento do pacote entra no vetor e o anterior fica
+// obsoleto, sendo descartado na próxima compactação. Assim a consulta CL
+// vira uma varredura linear, sem montar árvore.
+//
+// Cada entrada guarda a sequência em que entrou no resumo, o que permite
+// responder por uma versão anterior (ver validaNaVersao). A compactação só
+// descarta o que já estava obsoleto na versão mínima ainda consultável.
+class ResumoCliente {
+private:
+    struct Entrada {
+        Evento* evento;
+        const Pacote* pacote;
+        long long sequencia; // Sequência do evento que criou a entrada
+    };
+
+    Entrada* entradas;
+    int tamanho;
+    int capacidade;
+    int vivos; // Entradas ainda válidas (primeiro ou último evento do pacote)
+
+    void crescer();
+    void compactar(long long versaoMinima);
+
+public:
+    ResumoCliente();
+    ~ResumoCliente();
+
+    ResumoCliente(const ResumoCliente&) = delete;
+    ResumoCliente& operator=(const ResumoCliente&) = delete;
+
+    // Insere o evento mantendo a ordem (procura a posição a partir do fim).
+    // sequencia é a do evento que causou a inclusão; versaoMinima é a versão
+    // mais antiga que ainda pode ser consultada.
+    void adicionar(Evento* ev, const Pacote* pacote, long long sequencia,
+                   long long versaoMinima = VERSAO_ATUAL);
+    // Avisa que um evento antes registrado deixou de ser primeiro ou último
+    void invalidar();
+
+    int getVivos() const;
+    int getTamanho() const;
+    // A entrada i só deve ser listada se ainda for válida
+    bool valida(int i) const {
+        const Entrada& e = entradas[i];
+        return e.evento == e.pacote->getPrimeiroEvento() || e.evento == e.pacote->getUltimoEvento();
+    }
+    // Mesma coisa, mas na versão dada: a entrada já existia e o evento era o
+    // primeiro ou o último do pacote entre os eventos com sequencia < versao
+    bool validaNaVersao(int i, long long versao) const {
+        const Entrada& e = entradas[i];
+        return e.sequencia < versao &&
+               (e.evento == e.pacote->getPrimeiroEvento() || e.evento == e.pacote->getUltimoEventoNaVersao(versao));
+    }
+    Evento* getEvento(int i) const { return entradas[i].evento; }
+    const Pacote* getPacote(int i) const { return entradas[i].pacote; }
+    long long getSequencia(int i) const { return entradas[i].sequencia; }
+
+    // Usados pelo snapshot: restaurar() prepara um resumo vazio para total
+    // entradas, das quais vivos são válidas, e anexar() as acrescenta na
+    // ordem em que foram salvas (já em ordem de chave)
+    void restaurar(int total, int vivos);
+    void anexar(Evento* ev, const Pacote* pacote, long long sequencia);
+};
+
+#endif
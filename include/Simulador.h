@@ -1,49 +1,151 @@
 #ifndef SISTEMA_LOGISTICO_HPP
 #define SISTEMA_LOGISTICO_HPP
 
-#include "ArvorePacotes.h"
-#include "ArvoreClientes.h"
+#include "TabelaPacotes.h"
+#include "DiretorioClientes.h"
 #include "ArvoreEventos.h"
 #include "ArvoreRotas.h" // extra
+#include "IndiceArmazens.h"
+#include "EventosColunares.h"
+#include "PoolObjetos.h"
+#include "TabelaNomes.h"
+#include "EscritorSaida.h"
 #include "Evento.h"
 #include "Pacote.h"
 #include "Cliente.h"
-#include "ListaEventos.h"
 #include "ListaPacotes.h"
+#include "LeitorEntrada.h"
+#include "Consulta.h"
+#include "RespostaConsulta.h"
+#include "LeitorParalelo.h"
+#include "Instrumentacao.h"
 #include <string>
+#include <cstddef>
+#include <ostream>
 
 using namespace std;
 
+struct EstatisticasPipeline;
+struct EstatisticasFluxo;
+
+// Estrutura que guarda o conjunto global de eventos: as colunas ordenadas
+// por tempo (padrão) ou a AVL. Nos dois modos a consulta MA lê só a fatia
+// do armazém no índice por armazém.
+enum ModoEventos {
+    EVENTOS_AVL,
+    EVENTOS_COLUNAR
+};
+
 // A classe Simulador orquestra toda a simulação logística,
 // gerenciando pacotes, clientes e eventos.
 class Simulador {
 private:
-    ArvorePacotes pacotes;
-    ArvoreClientes clientes;
+    // Objetos da simulação, alocados em blocos e liberados juntos no fim.
+    // Declarados antes dos índices, que apenas apontam para eles.
+    PoolObjetos<Evento> poolEventos;
+    PoolObjetos<Pacote> poolPacotes;
+    PoolObjetos<Cliente> poolClientes;
+    TabelaNomes nomes; // Nomes de clientes internados; os eventos guardam só os IDs
+
+    TabelaPacotes pacotes; // Vetor direto pelo id, ou hash se os ids forem esparsos
+    DiretorioClientes clientes; // Indexado pelo ID do nome em nomes
     ArvoreEventos eventos;
     ArvoreRotas rotasCongestionadas; // Adicionado para gerenciar o congestionamento
+    IndiceArmazens eventosPorArmazem; // Índice (armazém, tempo) para a consulta MA, nos dois modos
+    EventosColunares eventosColunares; // Usado no lugar de eventos no modo colunar
+    ModoEventos modoEventos;
+    long long proximaSequencia; // Ordem de chegada do próximo evento
+    long long versaoMinimaLeitura; // Versão mais antiga que ainda pode ser consultada
+    EscritorSaida saida; // Respostas das consultas, escritas em blocos grandes
+    FormatadorResposta formatador; // Destino padrão das respostas: escreve em saida
 
     Pacote* getPacote(int idPacote) const;
     Pacote* createPacote(int idPacote);
     Cliente* getCliente(const std::string& nome) const;
-    Cliente* createCliente(const std::string& nome);
+    Cliente* createCliente(int idNome);
+    void emitirEvento(DestinoResposta& destino, const Evento* e) const;
 
     // Métodos para as novas consultas
-    void processarConsultaMovimentacaoArmazem(istringstream& iss, int timestamp);
-    void processarConsultaRotasCongestionadas(int timestamp);
+    void avaliarConsultaMovimentacaoArmazem(CabecalhoResposta& cabecalho, DestinoResposta& destino, long long versao) const;
+    void avaliarConsultaRotasCongestionadas(CabecalhoResposta& cabecalho, DestinoResposta& destino) const;
+    // Corpo de avaliarConsultaNaVersao, sem a medida de tempo
+    void responderNaVersao(const Consulta& consulta, DestinoResposta& destino, long long versao) const;
+
+    // Estatísticas de leitura da entrada
+    size_t bytesLidos;
+    double segundosCarga;
+    Instrumentacao* instrumentacao; // Nula: nada é medido (ver Instrumentacao.h)
 
 
 public:
-    Simulador();
+    // fdSaida: descritor onde as respostas são escritas
+    explicit Simulador(int fdSaida = 1, ModoEventos modo = EVENTOS_COLUNAR);
     ~Simulador();
-    void carregarEventos(const std::string& nomeArquivo);
+    // Com threads > 1, a interpretação das linhas é feita em paralelo.
+    // Aceita também o log binário (ver LogBinario), reconhecido pela assinatura.
+    void carregarEventos(const std::string& nomeArquivo, int threads = 1);
+    // Lê os registros do log binário direto do mapa, sem interpretar texto
+    void carregarLogBinario(const std::string& nomeArquivo);
+    // Lê texto de um descritor (stdin, pipe, FIFO) aos poucos, com buffer de
+    // tamanho fixo, e entrega as respostas antes de esperar por mais dados
+    void carregarFluxo(int fd, EstatisticasFluxo* estatisticas = nullptr);
+    // Carga em pipeline (leitura, aplicação e saída em threads separadas);
+    // se estatisticas não for nulo, recebe as latências e ocupações das filas
+    void carregarEventosEmPipeline(const std::string& nomeArquivo, EstatisticasPipeline* estatisticas = nullptr);
+    // Carga em épocas: aplica os eventos e responde às consultas acumuladas
+    // em paralelo, cada uma na versão em que apareceu (ver ExecutorConsultas)
+    void carregarEventosComConsultasParalelas(const std::string& nomeArquivo, int threads);
+    // Aplica um lote já interpretado; linhaBase numera as linhas nos avisos
+    void aplicarLote(const LoteLinhas& lote, int linhaBase, DestinoResposta& destino);
     void processarEvento(const Evento& evento);
+    void processarLinha(const LinhaEntrada& linha);
+    // Mesma coisa, mas as respostas das consultas vão para o destino dado
+    void processarLinha(const LinhaEntrada& linha, DestinoResposta& destino);
     void processarConsulta(const string& linha);
+    void processarConsulta(const Consulta& consulta);
+    // Lê os índices e envia a resposta (cabeçalho e itens) ao destino.
+    // Consultas malformadas enviam só o cabeçalho e lançam runtime_error.
+    void avaliarConsulta(const Consulta& consulta, DestinoResposta& destino);
+    // Deixa os índices prontos para avaliarConsultaNaVersao
+    void prepararLeitura();
+    // Responde como se só os eventos com sequencia < versao existissem. Só lê
+    // os índices, então várias threads podem chamá-la ao mesmo tempo entre
+    // prepararLeitura() e o próximo evento. A versão não pode ser anterior à
+    // versão mínima em vigor quando os eventos foram aplicados; RC sempre
+    // responde pela versão atual.
+    // Com medidas, o tempo da consulta é registrado nela (uma por thread).
+    void avaliarConsultaNaVersao(const Consulta& consulta, DestinoResposta& destino, long long versao,
+                                 Instrumentacao* medidas = nullptr) const;
+
+    // Grava o estado atual, com as estruturas já montadas, num snapshot
+    // binário (ver Snapshot.h)
+    void salvarSnapshot(const std::string& nomeArquivo) const;
+    // Refaz o estado a partir de um snapshot, sem reaplicar eventos; o
+    // simulador precisa estar vazio, e o snapshot pode vir do outro modo de
+    // eventos. Lança runtime_error se o snapshot estiver corrompido.
+    void restaurarSnapshot(const std::string& nomeArquivo);
+
+    // Tabela usada para converter nomes de clientes em IDs e vice-versa
+    TabelaNomes& getNomes();
+    const TabelaNomes& getNomes() const;
+
+    // Bytes lidos e tempo gasto em carregarEventos (leitura + processamento)
+    size_t getBytesLidos() const;
+    double getSegundosCarga() const;
 
-    // Retorna o histórico de eventos de um pacote específico.
-    ListaEventos getHistoricoPacote(int idPacote) const;
     // Retorna os pacotes associados a um cliente.
     ListaPacotes getPacotesCliente(const string& nomeCliente) const;
+    // Envia imediatamente as respostas ainda no buffer de saída
+    void descarregarSaida();
+
+    // Passa a medir as etapas na instrumentação dada (nullptr desliga). Só tem
+    // efeito se compilado com TP3_ESTATISTICAS. As threads de leitura
+    // (--threads, --pipeline) e de consultas (--consultas-paralelas) medem
+    // em instrumentações próprias, juntadas a esta a cada lote.
+    void ligarInstrumentacao(Instrumentacao* instrumentacao);
+    Instrumentacao* getInstrumentacao() const;
+    // Resumo da instrumentação ligada, mais o uso dos pools de objetos
+    void imprimirEstatisticas(std::ostream& saida) const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "Evento.h"
+#include "FormatoBinario.h"
+#include "TabelaNomes.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Snapshot binário do estado do Simulador, gravado em qualquer ponto da
+// carga e mapeado em memória ao iniciar. Usa o layout de FormatoBinario com
+// registros de tamanho variável: a seção de nomes é a TabelaNomes inteira,
+// em ordem de ID, e os registros são as estruturas já montadas, em seções
+// (CabecalhoSecao + elementos, com zeros no fim até múltiplo de 8), sempre
+// na ordem de SecaoSnapshot.
+//
+// Referências a eventos são índices em EVENTOS, que estão em ordem de
+// chegada (o índice é a sequencia); clientes são IDs de nome. A restauração
+// copia os eventos em bloco e só acerta os ponteiros, sem reaplicar eventos;
+// as colunas de EventosColunares saem dos eventos na ordem de LINHAS, e o
+// modo AVL ainda reinsere os eventos nas árvores.
+extern const char MAGICA_SNAPSHOT[8]; // "TP3SNAP" e '\0'
+const uint32_t VERSAO_SNAPSHOT = 3;
+
+enum SecaoSnapshot {
+    SECAO_EVENTOS,          // RegistroEvento, em ordem de chegada
+    SECAO_LINHAS,           // int32: evento de cada linha, em ordem de chave
+    SECAO_PACOTES,          // RegistroPacote
+    SECAO_HISTORICOS,       // int32: eventos de cada pacote, em sequência
+    SECAO_VINCULOS,         // int32: clientes vinculados de cada pacote
+    SECAO_CLIENTES,         // RegistroCliente
+    SECAO_PACOTES_CLIENTES, // int32: pacotes como remetente, depois como destinatário
+    SECAO_RESUMOS,          // RegistroResumo, o ResumoCliente de cada cliente
+    SECAO_ROTAS,            // RegistroRota, em ordem de ranking
+    TOTAL_SECOES
+};
+
+struct CabecalhoSecao {
+    uint32_t secao;
+    uint32_t tamanhoElemento; // Para detectar layouts diferentes
+    uint64_t total;
+};
+
+// Evento com campos de tamanho fixo; nomes são IDs da seção de nomes.
+// Mesmo layout de Evento, para ser copiado em bloco.
+struct RegistroEvento {
+    int64_t sequencia;
+    int32_t tempo;
+    int32_t idPacote;
+    int32_t armazemOrigem;
+    int32_t armazemDestino;
+    int32_t secaoDestino;
+    int32_t remetente;
+    int32_t destinatario;
+    int32_t tipo;
+};
+
+struct RegistroPacote {
+    int32_t id;
+    int32_t primeiroEvento; // -1 se nenhum
+    int32_t ultimoEvento;
+    int32_t totalHistorico;
+    int32_t totalVinculados;
+    int32_t reservado;
+};
+
+struct RegistroCliente {
+    int32_t idNome;
+    int32_t totalRemetente;
+    int32_t totalDestinatario;
+    int32_t totalResumo;
+    int32_t vivos;
+    int32_t reservado;
+};
+
+struct RegistroResumo {
+    int64_t sequencia;
+    int32_t evento; // O pacote é o do evento
+    int32_t reservado;
+};
+
+struct RegistroRota {
+    int32_t origem;
+    int32_t destino;
+    int32_t contagem;
+    int32_t reservado;
+};
+
+RegistroEvento paraRegistro(const Evento& ev);
+
+// Grava uma seção inteira de uma vez
+void gravarSecao(GravadorBinario& gravador, SecaoSnapshot secao, const void* dados,
+                 size_t tamanhoElemento, uint64_t total);
+
+// Percorre as seções de um snapshot aberto, na ordem. Lança runtime_error
+// se a seção seguinte não for a esperada ou passar do fim do arquivo.
+class LeitorSecoes {
+private:
+    const char* atual;
+    const char* fim;
+
+public:
+    explicit LeitorSecoes(const LeitorBinario& snapshot);
+    // Os elementos apontam para dentro do mapa (alinhados em 8 bytes)
+    const void* ler(SecaoSnapshot secao, size_t tamanhoElemento, uint64_t& total);
+    bool terminou() const { return atual == fim; }
+};
+
+#endif
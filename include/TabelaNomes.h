@@ -0,0 +1,49 @@
+#ifndef TABELA_NOMES_H
+#define TABELA_NOMES_H
+
+#include "PoolObjetos.h"
+#include <string>
+
+// Tabela de internação de nomes de clientes: associa cada nome distinto a um
+// ID inteiro denso (0, 1, 2, ...). Os eventos guardam só os IDs, e o nome é
+// recuperado apenas na hora de imprimir.
+//
+// A busca usa endereçamento aberto com sondagem linear; o hash de cada nome
+// fica guardado para que a comparação de strings só aconteça quando os hashes
+// coincidem. As strings ficam num pool e nunca mudam de endereço.
+class TabelaNomes {
+private:
+    struct Entrada {
+        const std::string* nome;
+        unsigned int hash;
+    };
+
+    PoolObjetos<std::string> textos;
+    Entrada* entradas;   // indexado pelo ID
+    int totalNomes;
+    int capacidadeEntradas;
+    int* slots;          // tabela hash: ID do nome ou -1 se vazio
+    int capacidadeSlots; // sempre potência de 2
+
+    int procurarSlot(const char* texto, int tamanho, unsigned int hash) const;
+    void redimensionar();
+
+public:
+    TabelaNomes();
+    ~TabelaNomes();
+
+    TabelaNomes(const TabelaNomes&) = delete;
+    TabelaNomes& operator=(const TabelaNomes&) = delete;
+
+    // Retorna o ID do nome, criando-o se ainda não existir
+    int internar(const char* texto, int tamanho);
+    int internar(const std::string& nome);
+    // Retorna o ID do nome ou -1 se ele não existir
+    int buscar(const char* texto, int tamanho) const;
+    const std::string& getNome(int id) const;
+    int tamanho() const;
+
+    static unsigned int calcularHash(const char* texto, int tamanho);
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TABELA_PACOTES_H
+#define TABELA_PACOTES_H
+
+#include "Pacote.h"
+
+// Tabela de pacotes indexada pelo id, com a mesma interface da ArvorePacotes.
+// Enquanto os ids observados forem densos (não negativos e sem grandes
+// buracos), os pacotes ficam num vetor acessado direto pelo id. Se os ids se
+// mostrarem esparsos, a tabela passa para uma hash de endereçamento aberto;
+// a decisão é reavaliada sempre que a estrutura precisa crescer.
+class TabelaPacotes {
+public:
+    enum Modo { MODO_DENSO, MODO_HASH };
+
+private:
+    // Um id só é aceito no vetor se couber em FATOR_DENSIDADE vezes o número
+    // de pacotes (mais uma folga fixa); caso contrário os ids são esparsos
+    static const int FATOR_DENSIDADE = 4;
+    static const int FOLGA_DENSA = 1024;
+
+    struct Slot {
+        int chave;
+        Pacote* pacote; // nullptr = vazio
+    };
+
+    Modo modo;
+    int contador;
+    int menorId;
+    int maiorId;
+
+    Pacote** vetor;   // Modo denso: vetor[id]
+    int capacidadeVetor;
+
+    Slot* slots;      // Modo hash
+    int capacidadeHash; // sempre potência de 2
+
+    bool cabeNoVetor(int menor, int maior, int total) const;
+    void crescerVetor(int id);
+    void paraHash();
+    void paraDenso();
+    void redimensionarHash();
+    int procurarSlot(int chave) const;
+    void inserirHash(Pacote* pacote);
+    void removerHash(int chave);
+
+public:
+    TabelaPacotes();
+    ~TabelaPacotes();
+
+    TabelaPacotes(const TabelaPacotes&) = delete;
+    TabelaPacotes& operator=(const TabelaPacotes&) = delete;
+
+    void inserir(Pacote* pacote);
+    void remover(int chave);
+    Pacote* buscar(int chave) const;
+    void emOrdem(void (*visitar)(Pacote*)) const;
+    int tamanho() const;
+    Modo getModo() const;
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef VETOR_EVENTOS_H
+#define VETOR_EVENTOS_H
+
+#include "Evento.h"
+
+// Vetor dinâmico de ponteiros para eventos, mantido em ordem crescente de chave.
+// Não é dono dos eventos: apenas os referencia. A inserção procura a posição
+// a partir do fim, então eventos que chegam em ordem custam O(1) amortizado.
+class VetorEventos {
+private:
+    Evento** dados;
+    int tamanho;
+    int capacidade;
+
+    void crescer();
+
+public:
+    VetorEventos();
+    ~VetorEventos();
+
+    VetorEventos(const VetorEventos&) = delete;
+    VetorEventos& operator=(const VetorEventos&) = delete;
+
+    // Insere mantendo a ordem; retorna false se o evento já estava no vetor.
+    bool inserirOrdenado(Evento* ev);
+    // Substitui o conteúdo por total eventos já em ordem de chave
+    void atribuir(Evento* const* eventos, int total);
+    // Move para cá os eventos de outro vetor ordenado (que fica vazio), numa
+    // passada de trás para frente: só os posteriores ao mais antigo deles
+    // são deslocados
+    void mesclar(VetorEventos& outro);
+    // A chave do último evento é menor que a do evento dado (anexar mantém a ordem)
+    bool aceitaNoFim(const Evento* ev) const;
+    Evento* get(int indice) const;
+    // Busca binária: primeiro índice com tempo >= tempo (ou > tempo, no caso do superior)
+    int limiteInferior(int tempo) const;
+    int limiteSuperior(int tempo) const;
+    int getTamanho() const;
+    bool estaVazio() const;
+};
+
+#endif
@@ -11,10 +11,8 @@ NoCliente::NoCliente(Cliente *d) : dados(d), esquerda(nullptr), direita(nullptr)
 // Construtor da árvore: inicializa raiz nula e contador zerado
 ArvoreClientes::ArvoreClientes() : raiz(nullptr), contador(0) {}
 
-// Destrutor: limpa toda a árvore recursivamente
-ArvoreClientes::~ArvoreClientes() {
-    limpar(raiz);
-}
+// Destrutor: os nós são liberados de uma vez pelo pool
+ArvoreClientes::~ArvoreClientes() {}
 
 // Insere novo cliente na árvore e incrementa contador
 void ArvoreClientes::inserir(Cliente *novoCliente) {
@@ -22,15 +20,6 @@ void ArvoreClientes::inserir(Cliente *novoCliente) {
     contador++;
 }
 
-// Limpa a árvore recursivamente (pós-ordem)
-void ArvoreClientes::limpar(NoCliente *no) {
-    if (no) {
-        limpar(no->esquerda);
-        limpar(no->direita);
-        delete no;
-    }
-}
-
 // Retorna a altura de um nó (0 se nulo)
 int ArvoreClientes::altura(NoCliente *no) const {
     return no ? no->altura : 0;
@@ -103,7 +92,7 @@ NoCliente *ArvoreClientes::balancear(NoCliente *no) {
 
 // Insere nó mantendo a propriedade de árvore binária e balanceando
 NoCliente *ArvoreClientes::inserirNo(NoCliente *noAtual, Cliente *novoCliente) {
-    if (!noAtual) return new NoCliente(novoCliente);
+    if (!noAtual) return nos.criar(novoCliente);
     
     // Inserção ordenada por nome
     if (novoCliente->getNome() < noAtual->dados->getNome()) {
@@ -158,13 +147,13 @@ NoCliente *ArvoreClientes::removerNo(NoCliente *noAtual, const std::string &nome
             NoCliente *filho = noAtual->esquerda ? noAtual->esquerda : noAtual->direita;
             
             if (!filho) {  // Nó folha
-                delete noAtual;
+                nos.liberar(noAtual);
                 contador--;
                 return nullptr;
             } 
             else {  // Nó com 1 filho
                 *noAtual = *filho;  // Substitui pelo filho
-                delete filho;
+                nos.liberar(filho);
                 contador--;
             }
         } 
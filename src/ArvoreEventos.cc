@@ -11,7 +11,7 @@ int maximo(int a, int b) {
 NoEvento::NoEvento(Evento *ev) : dados(ev), esquerda(NULL), direita(NULL), altura(1) {}
 
 // Gera chave única para ordenação dos eventos
-int ArvoreEventos::getChave(Evento *ev) const {
+ChaveEvento ArvoreEventos::getChave(Evento *ev) const {
     return gerarChaveEvento(*ev);
 }
 
@@ -19,19 +19,8 @@ int ArvoreEventos::getChave(Evento *ev) const {
 // Construtor: inicializa árvore vazia
 ArvoreEventos::ArvoreEventos() : raiz(NULL), contador(0) {}
 
-// Destrutor: limpa toda a árvore
-ArvoreEventos::~ArvoreEventos() {
-    limpar(raiz);
-}
-
-// Limpa a árvore recursivamente em pós-ordem
-void ArvoreEventos::limpar(NoEvento *atual) {
-    if (atual != NULL) {
-        limpar(atual->esquerda);
-        limpar(atual->direita);
-        delete atual;
-    }
-}
+// Destrutor: os nós são liberados de uma vez pelo pool
+ArvoreEventos::~ArvoreEventos() {}
 
 // Retorna altura do nó (0 para nulo)
 int ArvoreEventos::altura(NoEvento *atual) const {
@@ -110,11 +99,12 @@ void ArvoreEventos::inserir(Evento *novoEvento) {
 
 // Insere nó mantendo ordenação e balanceamento
 NoEvento *ArvoreEventos::inserirNo(NoEvento *atual, Evento *novoEvento) {
-    if (!atual) return new NoEvento(novoEvento);
+    if (!atual) return nos.criar(novoEvento);
     
-    int chaveNovo = getChave(novoEvento);
-    int chaveAtual = getChave(atual->dados);
+    ChaveEvento chaveNovo = getChave(novoEvento);
+    ChaveEvento chaveAtual = getChave(atual->dados);
     
+    // Chaves só coincidem quando é o mesmo evento; nesse caso não duplica
     if (chaveNovo != chaveAtual) {
         if (chaveNovo < chaveAtual) {
             atual->esquerda = inserirNo(atual->esquerda, novoEvento);
@@ -126,14 +116,14 @@ NoEvento *ArvoreEventos::inserirNo(NoEvento *atual, Evento *novoEvento) {
     return balancear(atual);
 }
 
-// Busca evento por ID
-Evento *ArvoreEventos::buscar(int id) const {
+// Busca evento pela chave
+Evento *ArvoreEventos::buscar(const ChaveEvento &id) const {
     NoEvento *resultado = buscarNo(raiz, id);
     return resultado ? resultado->dados : NULL;
 }
 
-// Busca recursiva por ID
-NoEvento *ArvoreEventos::buscarNo(NoEvento *atual, int id) const {
+// Busca recursiva pela chave
+NoEvento *ArvoreEventos::buscarNo(NoEvento *atual, const ChaveEvento &id) const {
     if (!atual || getChave(atual->dados) == id) {
         return atual;
     }
@@ -144,20 +134,20 @@ NoEvento *ArvoreEventos::buscarNo(NoEvento *atual, int id) const {
     );
 }
 
-// Remove evento por ID
-void ArvoreEventos::remover(int id) {
+// Remove evento pela chave
+void ArvoreEventos::remover(const ChaveEvento &id) {
     raiz = removerNo(raiz, id);
 }
 
 // Remove nó e rebalanceia a árvore
-NoEvento *ArvoreEventos::removerNo(NoEvento *atual, int id) {
+NoEvento *ArvoreEventos::removerNo(NoEvento *atual, const ChaveEvento &id) {
     if (!atual) return NULL;
 
-    int chaveAtual = getChave(atual->dados);
+    ChaveEvento chaveAtual = getChave(atual->dados);
     
     if (id < chaveAtual) {
         atual->esquerda = removerNo(atual->esquerda, id);
-    } else if (id > chaveAtual) {
+    } else if (chaveAtual < id) {
         atual->direita = removerNo(atual->direita, id);
     } else {
         // Nó com 0 ou 1 filho
@@ -165,12 +155,12 @@ NoEvento *ArvoreEventos::removerNo(NoEvento *atual, int id) {
             NoEvento *temp = atual->esquerda ? atual->esquerda : atual->direita;
             
             if (!temp) {  // Nó folha
-                delete atual;
+                nos.liberar(atual);
                 contador--;
                 return NULL;
             } else {  // Nó com 1 filho
                 *atual = *temp;  // Substitui pelo filho
-                delete temp;
+                nos.liberar(temp);
                 contador--;
             }
         } else {  // Nó com 2 filhos
@@ -227,8 +217,9 @@ void ArvoreEventos::coletarNoIntervalo(NoEvento* no, int tempoInicio, int tempoF
 
     int tempoAtual = no->dados->tempo;
 
-    // A chave da árvore de eventos é baseada no tempo, então podemos podar a busca
-    if (tempoInicio < tempoAtual) {
+    // A chave da árvore de eventos é baseada no tempo, então podemos podar a busca.
+    // Eventos com o mesmo tempo podem estar nas duas subárvores, daí o <= e o >=.
+    if (tempoInicio <= tempoAtual) {
         coletarNoIntervalo(no->esquerda, tempoInicio, tempoFim, lista);
     }
 
@@ -236,7 +227,7 @@ void ArvoreEventos::coletarNoIntervalo(NoEvento* no, int tempoInicio, int tempoF
         lista.push_back(*(no->dados));
     }
     
-    if (tempoFim > tempoAtual) {
+    if (tempoFim >= tempoAtual) {
         coletarNoIntervalo(no->direita, tempoInicio, tempoFim, lista);
     }
 }
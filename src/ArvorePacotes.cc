@@ -11,19 +11,8 @@ NoPacote::NoPacote(Pacote* d) : pacote(d), esquerda(nullptr), direita(nullptr),
 // Construtor da árvore: inicializa raiz nula e totalPacotes zerado
 ArvorePacotes::ArvorePacotes() : raiz(nullptr), totalPacotes(0) {}
 
-// Destrutor: limpa toda a árvore recursivamente
-ArvorePacotes::~ArvorePacotes() {
-    limpar(raiz);
-}
-
-// Limpa a árvore em pós-ordem (esquerda, direita, raiz)
-void ArvorePacotes::limpar(NoPacote* no) {
-    if (no) {
-        limpar(no->esquerda);
-        limpar(no->direita);
-        delete no;
-    }
-}
+// Destrutor: os nós são liberados de uma vez pelo pool
+ArvorePacotes::~ArvorePacotes() {}
 
 // Retorna altura do nó (0 se nulo)
 int ArvorePacotes::altura(NoPacote* no) const {
@@ -106,7 +95,7 @@ void ArvorePacotes::inserir(Pacote* dados) {
 
 // Inserção recursiva com balanceamento
 NoPacote* ArvorePacotes::inserir(NoPacote* no, Pacote* dados) {
-    if (!no) return new NoPacote(dados);  // Cria novo nó se chegou na posição correta
+    if (!no) return nos.criar(dados);  // Cria novo nó se chegou na posição correta
     
     // Inserção ordenada por ID
     if (dados->getId() < no->pacote->getId()) {
@@ -162,7 +151,7 @@ NoPacote* ArvorePacotes::remover(NoPacote* no, int chave) {
             } else {  // Nó com 1 filho
                 *no = *temp;  // Copia filho para o nó atual
             }
-            delete temp;
+            nos.liberar(temp);
             totalPacotes--;
         } else {  // Nó com 2 filhos
             NoPacote* temp = noMinimo(no->direita);  // Encontra sucessor
@@ -4,21 +4,13 @@
 // Construtor do Nó
 NoRota::NoRota(int origem, int destino) : dados(origem, destino), esquerda(nullptr), direita(nullptr), altura(1) {}
 
-// Construtor da Árvore
-ArvoreRotas::ArvoreRotas() : raiz(nullptr) {}
+NoRanking::NoRanking(Rota* rota) : rota(rota), esquerda(nullptr), direita(nullptr), altura(1) {}
 
-// Destrutor
-ArvoreRotas::~ArvoreRotas() {
-    limpar(raiz);
-}
+// Construtor da Árvore
+ArvoreRotas::ArvoreRotas() : raiz(nullptr), raizRanking(nullptr), totalRotas(0) {}
 
-void ArvoreRotas::limpar(NoRota* no) {
-    if (no) {
-        limpar(no->esquerda);
-        limpar(no->direita);
-        delete no;
-    }
-}
+// Destrutor: os nós das duas árvores são liberados pelos pools
+ArvoreRotas::~ArvoreRotas() {}
 
 // Gera uma chave única para a rota para ordenação na árvore
 long long ArvoreRotas::getChave(int origem, int destino) const {
@@ -83,7 +75,7 @@ NoRota* ArvoreRotas::balancear(NoRota* no) {
 
 
 NoRota* ArvoreRotas::inserirNo(NoRota* no, int origem, int destino) {
-    if (!no) return new NoRota(origem, destino);
+    if (!no) return nos.criar(origem, destino);
 
     long long chaveNova = getChave(origem, destino);
     long long chaveAtual = getChave(no->dados);
@@ -114,25 +106,158 @@ NoRota* ArvoreRotas::buscarNo(NoRota* no, int origem, int destino) const {
     }
 }
 
+// Atualiza a contagem da rota, reposicionando-a na árvore de ranking em O(log R)
 void ArvoreRotas::incrementar(int origem, int destino) {
     NoRota* no = buscarNo(raiz, origem, destino);
     if (no) {
+        NoRanking* noRanking = nullptr;
+        raizRanking = removerRanking(raizRanking, no->dados.contagem, getChave(no->dados), noRanking);
         no->dados.contagem++;
+        raizRanking = inserirRanking(raizRanking, noRanking);
     } else {
         raiz = inserirNo(raiz, origem, destino);
+        NoRota* novo = buscarNo(raiz, origem, destino);
+        raizRanking = inserirRanking(raizRanking, nosRanking.criar(&novo->dados));
+        totalRotas++;
     }
 }
 
-void ArvoreRotas::coletarRotas(NoRota* no, ListaRotas& lista) const {
-    if (no) {
-        coletarRotas(no->esquerda, lista);
-        lista.inserirOrdenado(no->dados);
-        coletarRotas(no->direita, lista);
+void ArvoreRotas::restaurar(int origem, int destino, int contagem) {
+    raiz = inserirNo(raiz, origem, destino);
+    NoRota* novo = buscarNo(raiz, origem, destino);
+    novo->dados.contagem = contagem;
+    raizRanking = inserirRanking(raizRanking, nosRanking.criar(&novo->dados));
+    totalRotas++;
+}
+
+// Percorre o ranking em ordem, parando assim que o limite é atingido
+void ArvoreRotas::coletarRotas(NoRanking* no, ListaRotas& lista, int limite) const {
+    if (!no || (limite >= 0 && lista.getTamanho() >= limite)) return;
+
+    coletarRotas(no->esquerda, lista, limite);
+    if (limite < 0 || lista.getTamanho() < limite) {
+        lista.push_back(*no->rota);
     }
+    coletarRotas(no->direita, lista, limite);
 }
 
-ListaRotas ArvoreRotas::getRotasOrdenadas() const {
+ListaRotas ArvoreRotas::getRotasOrdenadas(int limite) const {
     ListaRotas lista;
-    coletarRotas(raiz, lista);
+    coletarRotas(raizRanking, lista, limite);
     return lista;
-}
\ No newline at end of file
+}
+
+int ArvoreRotas::tamanho() const {
+    return totalRotas;
+}
+
+// ---- AVL de ranking ----
+
+int ArvoreRotas::altura(NoRanking* no) const {
+    return no ? no->altura : 0;
+}
+
+void ArvoreRotas::setAltura(NoRanking* no) {
+    if (no) {
+        no->altura = 1 + std::max(altura(no->esquerda), altura(no->direita));
+    }
+}
+
+int ArvoreRotas::getBalanceamento(NoRanking* no) const {
+    return no ? altura(no->esquerda) - altura(no->direita) : 0;
+}
+
+// Maior contagem primeiro; em empate, menor chave primeiro (mesma ordem da lista antiga)
+bool ArvoreRotas::vemAntes(int contagemA, long long chaveA, const Rota& b) const {
+    if (contagemA != b.contagem) return contagemA > b.contagem;
+    return chaveA < getChave(b);
+}
+
+NoRanking* ArvoreRotas::rotacaoDireita(NoRanking* y) {
+    NoRanking* x = y->esquerda;
+    NoRanking* T2 = x->direita;
+    x->direita = y;
+    y->esquerda = T2;
+    setAltura(y);
+    setAltura(x);
+    return x;
+}
+
+NoRanking* ArvoreRotas::rotacaoEsquerda(NoRanking* x) {
+    NoRanking* y = x->direita;
+    NoRanking* T2 = y->esquerda;
+    y->esquerda = x;
+    x->direita = T2;
+    setAltura(x);
+    setAltura(y);
+    return y;
+}
+
+NoRanking* ArvoreRotas::balancear(NoRanking* no) {
+    setAltura(no);
+    int balanco = getBalanceamento(no);
+    if (balanco > 1) {
+        if (getBalanceamento(no->esquerda) < 0) {
+            no->esquerda = rotacaoEsquerda(no->esquerda);
+        }
+        return rotacaoDireita(no);
+    }
+    if (balanco < -1) {
+        if (getBalanceamento(no->direita) > 0) {
+            no->direita = rotacaoDireita(no->direita);
+        }
+        return rotacaoEsquerda(no);
+    }
+    return no;
+}
+
+// Insere um nó já alocado (reaproveitado a cada incremento)
+NoRanking* ArvoreRotas::inserirRanking(NoRanking* no, NoRanking* novo) {
+    if (!no) {
+        novo->esquerda = novo->direita = nullptr;
+        novo->altura = 1;
+        return novo;
+    }
+
+    if (vemAntes(novo->rota->contagem, getChave(*novo->rota), *no->rota)) {
+        no->esquerda = inserirRanking(no->esquerda, novo);
+    } else {
+        no->direita = inserirRanking(no->direita, novo);
+    }
+    return balancear(no);
+}
+
+// Desliga o menor nó da subárvore, devolvendo-o em 'minimo'
+NoRanking* ArvoreRotas::removerMinimoRanking(NoRanking* no, NoRanking*& minimo) {
+    if (!no->esquerda) {
+        minimo = no;
+        return no->direita;
+    }
+    no->esquerda = removerMinimoRanking(no->esquerda, minimo);
+    return balancear(no);
+}
+
+// Desliga (sem liberar) o nó com a contagem e chave dadas, devolvendo-o em 'removido'
+NoRanking* ArvoreRotas::removerRanking(NoRanking* no, int contagem, long long chave, NoRanking*& removido) {
+    if (!no) return nullptr;
+
+    if (no->rota->contagem == contagem && getChave(*no->rota) == chave) {
+        removido = no;
+        NoRanking* esquerda = no->esquerda;
+        NoRanking* direita = no->direita;
+        if (!direita) return esquerda;
+
+        NoRanking* sucessor = nullptr;
+        direita = removerMinimoRanking(direita, sucessor);
+        sucessor->esquerda = esquerda;
+        sucessor->direita = direita;
+        return balancear(sucessor);
+    }
+
+    if (vemAntes(contagem, chave, *no->rota)) {
+        no->esquerda = removerRanking(no->esquerda, contagem, chave, removido);
+    } else {
+        no->direita = removerRanking(no->direita, contagem, chave, removido);
+    }
+    return balancear(no);
+}
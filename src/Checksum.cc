@@ -0,0 +1,51 @@
+#include "Checksum.h"
+#include <cstring>
+
+namespace {
+
+// Tabelas do método "slicing-by-8": valores[0] é o CRC de cada byte, e
+// valores[k] o mesmo byte seguido de k bytes zero. Assim oito bytes são
+// processados por iteração, com oito consultas independentes.
+struct TabelaCrc32 {
+    uint32_t valores[8][256];
+
+    TabelaCrc32() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            valores[0][i] = c;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (int t = 1; t < 8; t++) {
+                valores[t][i] = (valores[t - 1][i] >> 8) ^ valores[0][valores[t - 1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+}
+
+uint32_t calcularCrc32(const void* dados, size_t tamanho, uint32_t crc) {
+    static const TabelaCrc32 tabela; // Montada na primeira chamada
+    const uint32_t (*v)[256] = tabela.valores;
+    const unsigned char* p = static_cast<const unsigned char*>(dados);
+    crc = ~crc;
+
+    // Assume ordem little-endian, como o resto dos formatos binários
+    for (; tamanho >= 8; tamanho -= 8, p += 8) {
+        uint32_t baixo, alto;
+        memcpy(&baixo, p, 4);
+        memcpy(&alto, p + 4, 4);
+        baixo ^= crc;
+        crc = v[7][baixo & 0xFF] ^ v[6][(baixo >> 8) & 0xFF] ^
+              v[5][(baixo >> 16) & 0xFF] ^ v[4][baixo >> 24] ^
+              v[3][alto & 0xFF] ^ v[2][(alto >> 8) & 0xFF] ^
+              v[1][(alto >> 16) & 0xFF] ^ v[0][alto >> 24];
+    }
+    for (; tamanho > 0; tamanho--, p++) {
+        crc = v[0][(crc ^ *p) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
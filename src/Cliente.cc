@@ -1,8 +1,9 @@
 #include "Cliente.h"
 
-Cliente::Cliente(const std::string &nome)
+Cliente::Cliente(const std::string &nome, int id)
 {
     this->nome = nome;
+    this->id = id;
 }
 void Cliente::imprimeCliente() const
 {
@@ -31,6 +32,11 @@ const std::string &Cliente::getNome() const
     return nome;
 }
 
+int Cliente::getId() const
+{
+    return id;
+}
+
 const ListaInt &Cliente::getPacotesRemetente() const
 {
     return pacotesRemetente;
@@ -39,4 +45,13 @@ const ListaInt &Cliente::getPacotesRemetente() const
 const ListaInt &Cliente::getPacotesDestinatario() const
 {
     return pacotesDestinatario;
-}
\ No newline at end of file
+}
+ResumoCliente &Cliente::getResumo()
+{
+    return resumo;
+}
+
+const ResumoCliente &Cliente::getResumo() const
+{
+    return resumo;
+}
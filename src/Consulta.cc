@@ -0,0 +1,12 @@
+#include "Consulta.h"
+
+// Nome do comando como aparece na entrada
+const char* Consulta::getNomeTipo() const {
+    switch (tipo) {
+        case CONSULTA_PC: return "PC";
+        case CONSULTA_CL: return "CL";
+        case CONSULTA_MA: return "MA";
+        case CONSULTA_RC: return "RC";
+    }
+    return "";
+}
@@ -0,0 +1,63 @@
+#include "DiretorioClientes.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+DiretorioClientes::DiretorioClientes() : vetor(nullptr), capacidade(0), contador(0) {}
+
+DiretorioClientes::~DiretorioClientes() {
+    delete[] vetor;
+}
+
+// Dobra o vetor até caber o ID; as posições novas ficam vazias
+void DiretorioClientes::crescer(int idNome) {
+    int novaCapacidade = capacidade ? capacidade : 64;
+    while (novaCapacidade <= idNome) novaCapacidade *= 2;
+    Cliente** novo = new Cliente*[novaCapacidade];
+    if (capacidade > 0) memcpy(novo, vetor, sizeof(Cliente*) * capacidade);
+    for (int i = capacidade; i < novaCapacidade; i++) novo[i] = nullptr;
+    delete[] vetor;
+    vetor = novo;
+    capacidade = novaCapacidade;
+}
+
+void DiretorioClientes::inserir(Cliente* novoCliente) {
+    int idNome = novoCliente->getId();
+    if (idNome < 0) {
+        throw std::runtime_error("Cliente sem ID de nome: " + novoCliente->getNome());
+    }
+    if (idNome >= capacidade) {
+        crescer(idNome);
+    }
+    if (!vetor[idNome]) {
+        contador++;
+    }
+    vetor[idNome] = novoCliente;
+}
+
+void DiretorioClientes::remover(int idNome) {
+    if (!buscar(idNome)) return;
+    vetor[idNome] = nullptr;
+    contador--;
+}
+
+int DiretorioClientes::tamanho() const {
+    return contador;
+}
+
+static bool nomeMenor(const Cliente* a, const Cliente* b) {
+    return a->getNome() < b->getNome();
+}
+
+void DiretorioClientes::emOrdem(void (*visitar)(Cliente*)) const {
+    Cliente** ordenados = new Cliente*[contador > 0 ? contador : 1];
+    int total = 0;
+    for (int i = 0; i < capacidade; i++) {
+        if (vetor[i]) ordenados[total++] = vetor[i];
+    }
+    std::sort(ordenados, ordenados + total, nomeMenor);
+    for (int i = 0; i < total; i++) {
+        visitar(ordenados[i]);
+    }
+    delete[] ordenados;
+}
@@ -0,0 +1,142 @@
+#include "EscritorSaida.h"
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <unistd.h>
+
+// Pares de dígitos de 00 a 99, para converter dois dígitos por vez
+static const char DIGITOS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Escreve os dígitos de 'valor' terminando em 'fim'; retorna o início
+static char* converter(unsigned long long valor, char* fim) {
+    while (valor >= 100) {
+        unsigned int par = static_cast<unsigned int>(valor % 100) * 2;
+        valor /= 100;
+        *--fim = DIGITOS[par + 1];
+        *--fim = DIGITOS[par];
+    }
+    if (valor >= 10) {
+        unsigned int par = static_cast<unsigned int>(valor) * 2;
+        *--fim = DIGITOS[par + 1];
+        *--fim = DIGITOS[par];
+    } else {
+        *--fim = static_cast<char>('0' + valor);
+    }
+    return fim;
+}
+
+EscritorSaida::EscritorSaida(int fd, size_t capacidade)
+    : fd(fd), buffer(new char[capacidade]), capacidade(capacidade), usado(0) {}
+
+EscritorSaida::~EscritorSaida() {
+    try {
+        descarregar();
+    } catch (const std::exception&) {
+        // Não há a quem reportar o erro durante a destruição
+    }
+    delete[] buffer;
+}
+
+void EscritorSaida::garantirEspaco(size_t bytes) {
+    if (capacidade - usado < bytes) {
+        if (fd != MEMORIA) {
+            descarregar();
+            return;
+        }
+        size_t novaCapacidade = capacidade * 2;
+        while (novaCapacidade - usado < bytes) novaCapacidade *= 2;
+        char* novo = new char[novaCapacidade];
+        memcpy(novo, buffer, usado);
+        delete[] buffer;
+        buffer = novo;
+        capacidade = novaCapacidade;
+    }
+}
+
+void EscritorSaida::descarregar() {
+    if (fd == MEMORIA) return;
+    size_t enviado = 0;
+    while (enviado < usado) {
+        ssize_t n = write(fd, buffer + enviado, usado - enviado);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            usado = 0;
+            throw std::runtime_error(std::string("Erro ao escrever a saida: ") + strerror(errno));
+        }
+        enviado += static_cast<size_t>(n);
+    }
+    usado = 0;
+}
+
+void EscritorSaida::escreverTexto(const char* texto, size_t tamanho) {
+    if (tamanho > capacidade && fd != MEMORIA) {
+        // Texto maior que o buffer inteiro: escreve direto
+        descarregar();
+        size_t enviado = 0;
+        while (enviado < tamanho) {
+            ssize_t n = write(fd, texto + enviado, tamanho - enviado);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Erro ao escrever a saida: ") + strerror(errno));
+            }
+            enviado += static_cast<size_t>(n);
+        }
+        return;
+    }
+    garantirEspaco(tamanho);
+    memcpy(buffer + usado, texto, tamanho);
+    usado += tamanho;
+}
+
+void EscritorSaida::escreverTexto(const std::string& texto) {
+    escreverTexto(texto.data(), texto.size());
+}
+
+void EscritorSaida::escreverChar(char c) {
+    garantirEspaco(1);
+    buffer[usado++] = c;
+}
+
+void EscritorSaida::escreverInteiro(long long valor) {
+    escreverInteiro(valor, 0);
+}
+
+void EscritorSaida::escreverInteiro(long long valor, int largura) {
+    char temporario[24];
+    char* fim = temporario + sizeof(temporario);
+    unsigned long long absoluto = valor < 0 ? 0ULL - static_cast<unsigned long long>(valor)
+                                            : static_cast<unsigned long long>(valor);
+    char* inicio = converter(absoluto, fim);
+    if (valor < 0) *--inicio = '-';
+
+    // O preenchimento vem antes do sinal, como no alinhamento padrão do iostream
+    size_t tamanho = static_cast<size_t>(fim - inicio);
+    size_t zeros = largura > 0 && static_cast<size_t>(largura) > tamanho ? static_cast<size_t>(largura) - tamanho : 0;
+    garantirEspaco(zeros + tamanho);
+    for (size_t i = 0; i < zeros; i++) buffer[usado++] = '0';
+    memcpy(buffer + usado, inicio, tamanho);
+    usado += tamanho;
+}
+
+void EscritorSaida::novaLinha() {
+    escreverChar('\n');
+}
+
+void EscritorSaida::setDescritor(int novoFd) {
+    descarregar();
+    fd = novoFd;
+}
+
+int EscritorSaida::getDescritor() const {
+    return fd;
+}
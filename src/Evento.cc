@@ -1,10 +1,72 @@
 #include "Evento.h"
-#include <sstream>
+#include "LeitorEntrada.h"
+#include "TabelaNomes.h"
+#include "EscritorSaida.h"
+#include <type_traits>
+#include <stdexcept>
 
-int gerarChaveEvento(const Evento& ev) {
-    // A chave é calculada para evitar colisões, assumindo limites razoáveis
-    // para o ID do pacote e o número de tipos de evento.
-    return (ev.tempo * 10000) + (ev.idPacote * 10) + static_cast<int>(ev.tipo);
+static_assert(std::is_trivially_copyable<Evento>::value, "Evento deve ser trivialmente copiavel");
+
+ChaveEvento gerarChaveEvento(const Evento& ev) {
+    // Tupla explícita em vez de um inteiro combinado: não há estouro para
+    // tempos grandes nem colisão entre IDs de pacote.
+    ChaveEvento chave;
+    chave.tempo = ev.tempo;
+    chave.idPacote = ev.idPacote;
+    chave.tipo = static_cast<int>(ev.tipo);
+    chave.sequencia = ev.sequencia;
+    return chave;
+}
+
+static const char* NOMES_TIPO[] = {"RG", "AR", "RM", "UR", "TR", "EN"};
+
+void escreverEvento(EscritorSaida& saida, const Evento& ev, const TabelaNomes& nomes) {
+    if (ev.tipo == RG) {
+        escreverEvento(saida, ev, &nomes.getNome(ev.remetente), &nomes.getNome(ev.destinatario));
+    } else {
+        escreverEvento(saida, ev, nullptr, nullptr);
+    }
+}
+
+void escreverEvento(EscritorSaida& saida, const Evento& ev, const std::string* remetente,
+                    const std::string* destinatario) {
+    saida.escreverInteiro(ev.tempo, 7);
+    saida.escreverTexto(" EV ", 4);
+    saida.escreverTexto(NOMES_TIPO[ev.tipo], 2);
+    saida.escreverChar(' ');
+    saida.escreverInteiro(ev.idPacote, 3);
+
+    switch (ev.tipo) {
+        case RG:
+            saida.escreverChar(' ');
+            saida.escreverTexto(*remetente);
+            saida.escreverChar(' ');
+            saida.escreverTexto(*destinatario);
+            saida.escreverChar(' ');
+            saida.escreverInteiro(ev.armazemOrigem, 3);
+            saida.escreverChar(' ');
+            saida.escreverInteiro(ev.armazemDestino, 3);
+            break;
+        case AR:
+            saida.escreverChar(' ');
+            saida.escreverInteiro(ev.armazemOrigem, 3);
+            saida.escreverChar(' ');
+            saida.escreverInteiro(ev.secaoDestino, 3);
+            break;
+        case RM:
+        case UR:
+        case TR:
+            saida.escreverChar(' ');
+            saida.escreverInteiro(ev.armazemOrigem, 3);
+            saida.escreverChar(' ');
+            saida.escreverInteiro(ev.armazemDestino, 3);
+            break;
+        case EN:
+            saida.escreverChar(' ');
+            saida.escreverInteiro(ev.armazemDestino, 3);
+            break;
+    }
+    saida.novaLinha();
 }
 
 // Converte uma string para o enum TipoEvento
@@ -22,42 +84,19 @@ TipoEvento Evento::lerTipo(const std::string& tipoStr) {
 }
 
 // Cria um objeto Evento a partir de uma linha de texto formatada.
-Evento Evento::lerEvento(const std::string& linha) {
-    std::istringstream stream(linha);
-    std::string token;
-
-    int timestamp;
-    int idPacote;
-
-    stream >> timestamp >> token;
-    stream >> token;
-    stream >> idPacote;
-
-    TipoEvento tipo = lerTipo(token);
-
-    std::string remetente, destinatario;
-    int armazemOrigem = -1;
-    int armazemDestino = -1;
-    int secaoDestino = -1;
-
-    switch (tipo) {
-        case RG:
-            stream >> remetente >> destinatario >> armazemOrigem >> armazemDestino;
-            break;
-        case AR:
-            stream >> armazemOrigem >> armazemDestino >> secaoDestino;
-            break;
-        case RM:
-        case UR:
-        case TR:
-            stream >> armazemOrigem >> armazemDestino;
-            break;
-        case EN:
-            stream >> armazemDestino;
-            break;
+Evento Evento::lerEvento(const std::string& linha, TabelaNomes& nomes) {
+    LinhaEntrada interpretada;
+    LeitorEntrada::interpretar(Fatia(linha.data(), static_cast<int>(linha.size())), interpretada);
+    if (interpretada.tipo != LINHA_EVENTO) {
+        throw std::runtime_error("Linha nao contem um evento: " + linha);
     }
 
-    return Evento(timestamp, tipo, idPacote, remetente, destinatario, armazemOrigem, armazemDestino, secaoDestino);
+    Evento evento(interpretada.evento);
+    if (evento.tipo == RG) {
+        evento.remetente = nomes.internar(interpretada.remetente.inicio, interpretada.remetente.tamanho);
+        evento.destinatario = nomes.internar(interpretada.destinatario.inicio, interpretada.destinatario.tamanho);
+    }
+    return evento;
 }
 
 // Construtor principal
@@ -65,14 +104,15 @@ Evento::Evento(
     int p_timestamp,
     TipoEvento p_tipo,
     int p_idPacote,
-    const std::string& p_remetente,
-    const std::string& p_destinatario,
+    int p_remetente,
+    int p_destinatario,
     int p_armazemOrigem,
     int p_armazemDestino,
     int p_secaoDestino
 ) {
     this->tempo = p_timestamp;
     this->tipo = p_tipo;
+    this->sequencia = 0;
     this->idPacote = p_idPacote;
     this->remetente = p_remetente;
     this->destinatario = p_destinatario;
@@ -80,15 +120,3 @@ Evento::Evento(
     this->armazemDestino = p_armazemDestino;
     this->secaoDestino = p_secaoDestino;
 }
-
-//faz uma copia
-Evento::Evento(const Evento& ev) {
-    this->tempo = ev.tempo;
-    this->tipo = ev.tipo;
-    this->idPacote = ev.idPacote;
-    this->remetente = ev.remetente;
-    this->destinatario = ev.destinatario;
-    this->armazemOrigem = ev.armazemOrigem;
-    this->armazemDestino = ev.armazemDestino;
-    this->secaoDestino = ev.secaoDestino;
-}
@@ -0,0 +1,217 @@
+#include "EventosColunares.h"
+#include "KernelsSimd.h"
+#include <cstring>
+
+EventosColunares::EventosColunares()
+    : tempos(nullptr), origens(nullptr), destinos(nullptr), eventos(nullptr), tamanho(0), capacidade(0),
+      indiceTempos(nullptr), capacidadeIndice(0), blocosValidos(0),
+      atrasados(nullptr), totalAtrasados(0), capacidadeAtrasados(0) {}
+
+EventosColunares::~EventosColunares() {
+    delete[] tempos;
+    delete[] origens;
+    delete[] destinos;
+    delete[] eventos;
+    delete[] indiceTempos;
+    delete[] atrasados;
+}
+
+// Copia uma coluna para um vetor novo de maior capacidade
+template <typename T>
+static void realocarColuna(T*& coluna, int usados, int novaCapacidade) {
+    T* nova = new T[novaCapacidade];
+    if (usados > 0) memcpy(nova, coluna, sizeof(T) * usados);
+    delete[] coluna;
+    coluna = nova;
+}
+
+void EventosColunares::crescer() {
+    int novaCapacidade = capacidade ? capacidade * 2 : 1024;
+    realocarColuna(tempos, tamanho, novaCapacidade);
+    realocarColuna(origens, tamanho, novaCapacidade);
+    realocarColuna(destinos, tamanho, novaCapacidade);
+    realocarColuna(eventos, tamanho, novaCapacidade);
+    capacidade = novaCapacidade;
+
+    int blocos = novaCapacidade / LINHAS_POR_BLOCO;
+    realocarColuna(indiceTempos, blocosValidos, blocos);
+    capacidadeIndice = blocos;
+}
+
+// Grava o evento na linha indicada de todas as colunas
+void EventosColunares::escreverLinha(int linha, Evento* ev) {
+    tempos[linha] = ev->tempo;
+    origens[linha] = ev->armazemOrigem;
+    destinos[linha] = ev->armazemDestino;
+    eventos[linha] = ev;
+}
+
+// Copia a linha origem para a linha destino em todas as colunas
+void EventosColunares::moverLinha(int origem, int destino) {
+    tempos[destino] = tempos[origem];
+    origens[destino] = origens[origem];
+    destinos[destino] = destinos[origem];
+    eventos[destino] = eventos[origem];
+}
+
+void EventosColunares::inserir(Evento* ev) {
+    ChaveEvento chave = gerarChaveEvento(*ev);
+
+    // Caminho rápido: entrada em ordem, a linha vai direto para o fim
+    if (tamanho == 0 || !(gerarChaveEvento(*eventos[tamanho - 1]) > chave)) {
+        if (tamanho == capacidade) {
+            crescer();
+        }
+        escreverLinha(tamanho++, ev);
+        return;
+    }
+
+    // Evento atrasado: entra no run lateral, na posição da chave
+    if (totalAtrasados == capacidadeAtrasados) {
+        int novaCapacidade = capacidadeAtrasados ? capacidadeAtrasados * 2 : MINIMO_ATRASADOS;
+        realocarColuna(atrasados, totalAtrasados, novaCapacidade);
+        capacidadeAtrasados = novaCapacidade;
+    }
+    int ini = 0, fim = totalAtrasados;
+    while (ini < fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (gerarChaveEvento(*atrasados[meio]) > chave) fim = meio;
+        else ini = meio + 1;
+    }
+    memmove(atrasados + ini + 1, atrasados + ini, sizeof(Evento*) * (totalAtrasados - ini));
+    atrasados[ini] = ev;
+    totalAtrasados++;
+
+    if (totalAtrasados >= limiteAtrasados()) {
+        mesclarAtrasados();
+    }
+}
+
+// Tamanho do run lateral que dispara a mescla: a menor potência de 2 (a
+// partir de MINIMO_ATRASADOS) cujo quadrado cobre as colunas. Cada mescla
+// custa O(n), e o run custa O(limite) por inserção e por consulta.
+int EventosColunares::limiteAtrasados() const {
+    int limite = MINIMO_ATRASADOS;
+    while (static_cast<long long>(limite) * limite < tamanho) limite *= 2;
+    return limite;
+}
+
+// Mescla o run lateral nas colunas de trás para frente, no próprio vetor:
+// só as linhas posteriores ao atrasado mais antigo são deslocadas
+void EventosColunares::mesclarAtrasados() {
+    if (totalAtrasados == 0) return;
+    while (tamanho + totalAtrasados > capacidade) {
+        crescer();
+    }
+
+    int linha = tamanho - 1;
+    int atrasado = totalAtrasados - 1;
+    int destino = tamanho + totalAtrasados - 1;
+    while (atrasado >= 0) {
+        if (linha >= 0 && gerarChaveEvento(*eventos[linha]) > gerarChaveEvento(*atrasados[atrasado])) {
+            moverLinha(linha--, destino--);
+        } else {
+            escreverLinha(destino--, atrasados[atrasado--]);
+        }
+    }
+
+    tamanho += totalAtrasados;
+    totalAtrasados = 0;
+
+    // Os blocos a partir da primeira linha alterada precisam ser reindexados
+    int bloco = (linha + 1) / LINHAS_POR_BLOCO;
+    if (bloco < blocosValidos) blocosValidos = bloco;
+}
+
+void EventosColunares::restaurar(int total, const int* indices, Evento* base) {
+    while (capacidade < total) {
+        crescer();
+    }
+    for (int i = 0; i < total; i++) {
+        Evento* ev = base + indices[i];
+        eventos[i] = ev;
+        tempos[i] = ev->tempo;
+        origens[i] = ev->armazemOrigem;
+        destinos[i] = ev->armazemDestino;
+    }
+    tamanho = total;
+    blocosValidos = 0;
+}
+
+int EventosColunares::getTamanho() const {
+    return tamanho + totalAtrasados;
+}
+
+void EventosColunares::atualizarIndice() const {
+    int blocos = (tamanho + LINHAS_POR_BLOCO - 1) / LINHAS_POR_BLOCO;
+    for (int b = blocosValidos; b < blocos; b++) {
+        indiceTempos[b] = tempos[b * LINHAS_POR_BLOCO];
+    }
+    blocosValidos = blocos;
+}
+
+void EventosColunares::prepararLeitura() {
+    atualizarIndice();
+}
+
+int EventosColunares::limiteInferior(int tempo) const {
+    // Último bloco cuja primeira linha tem tempo < tempo; a resposta está nele
+    // ou é a primeira linha do bloco seguinte
+    int ini = 0, fim = blocosValidos;
+    while (ini < fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (indiceTempos[meio] < tempo) ini = meio + 1;
+        else fim = meio;
+    }
+    if (ini == 0) return 0;
+
+    int linha = (ini - 1) * LINHAS_POR_BLOCO;
+    int limite = ini * LINHAS_POR_BLOCO;
+    if (limite > tamanho) limite = tamanho;
+    return linha + contarMenores(tempos + linha, limite - linha, tempo);
+}
+
+int EventosColunares::limiteSuperior(int tempo) const {
+    int ini = 0, fim = blocosValidos;
+    while (ini < fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (indiceTempos[meio] <= tempo) ini = meio + 1;
+        else fim = meio;
+    }
+    if (ini == 0) return 0;
+
+    int linha = (ini - 1) * LINHAS_POR_BLOCO;
+    int limite = ini * LINHAS_POR_BLOCO;
+    if (limite > tamanho) limite = tamanho;
+    return linha + contarMenoresOuIguais(tempos + linha, limite - linha, tempo);
+}
+
+int EventosColunares::contarArmazem(int inicio, int fim, int idArmazem) const {
+    return ::contarArmazem(origens + inicio, destinos + inicio, fim - inicio, idArmazem);
+}
+
+int EventosColunares::filtrarArmazem(int inicio, int fim, int idArmazem, int* linhas) const {
+    int total = ::filtrarArmazem(origens + inicio, destinos + inicio, fim - inicio, idArmazem, linhas);
+    for (int i = 0; i < total; i++) linhas[i] += inicio;
+    return total;
+}
+
+int EventosColunares::atrasadosInferior(int tempo) const {
+    int ini = 0, fim = totalAtrasados;
+    while (ini < fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (atrasados[meio]->tempo < tempo) ini = meio + 1;
+        else fim = meio;
+    }
+    return ini;
+}
+
+int EventosColunares::atrasadosSuperior(int tempo) const {
+    int ini = 0, fim = totalAtrasados;
+    while (ini < fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (atrasados[meio]->tempo <= tempo) ini = meio + 1;
+        else fim = meio;
+    }
+    return ini;
+}
@@ -0,0 +1,119 @@
+#include "ExecutorConsultas.h"
+#include "Simulador.h"
+#include <stdexcept>
+
+using namespace std;
+
+ExecutorConsultas::ExecutorConsultas(const Simulador& simulador, int threads, int capacidade)
+    : simulador(simulador), tarefas(new Tarefa[capacidade]), capacidade(capacidade), total(0),
+      auxiliares(nullptr), totalAuxiliares(threads > 1 ? threads - 1 : 0),
+      geracao(0), concluidas(0), encerrar(false), proxima(0),
+      medidas(new Instrumentacao[totalAuxiliares + 1]) {
+    if (totalAuxiliares > 0) {
+        auxiliares = new thread[totalAuxiliares];
+        for (int i = 0; i < totalAuxiliares; i++) {
+            auxiliares[i] = thread(&ExecutorConsultas::esperarLotes, this, i + 1);
+        }
+    }
+}
+
+ExecutorConsultas::~ExecutorConsultas() {
+    {
+        lock_guard<mutex> guarda(trava);
+        encerrar = true;
+    }
+    lotePublicado.notify_all();
+    for (int i = 0; i < totalAuxiliares; i++) {
+        auxiliares[i].join();
+    }
+    delete[] auxiliares;
+    delete[] tarefas;
+    delete[] medidas;
+}
+
+void ExecutorConsultas::adiar(const Consulta& consulta, long long versao) {
+    Tarefa& tarefa = tarefas[total++];
+    tarefa.consulta = consulta;
+    tarefa.versao = versao;
+    tarefa.pronta = false;
+    tarefa.texto.limpar();
+}
+
+EscritorSaida& ExecutorConsultas::responderAgora() {
+    Tarefa& tarefa = tarefas[total++];
+    tarefa.pronta = true;
+    tarefa.texto.limpar();
+    return tarefa.texto;
+}
+
+// Pega tarefas até acabarem; várias threads dividem o lote pelo contador
+void ExecutorConsultas::responderPendentes(int indice) {
+    Instrumentacao* minhas = simulador.getInstrumentacao() ? &medidas[indice] : nullptr;
+    int i;
+    while ((i = proxima.fetch_add(1)) < total) {
+        Tarefa& tarefa = tarefas[i];
+        if (tarefa.pronta) continue;
+        try {
+            FormatadorResposta formatador(tarefa.texto);
+            simulador.avaliarConsultaNaVersao(tarefa.consulta, formatador, tarefa.versao, minhas);
+        } catch (const std::exception& e) {
+            lock_guard<mutex> guarda(trava);
+            if (falha.empty()) falha = e.what();
+        }
+    }
+}
+
+// Laço das threads auxiliares: um lote por geração publicada
+void ExecutorConsultas::esperarLotes(int indice) {
+    long long vista = 0;
+    while (true) {
+        {
+            unique_lock<mutex> guarda(trava);
+            lotePublicado.wait(guarda, [&] { return encerrar || geracao != vista; });
+            if (encerrar) return;
+            vista = geracao;
+        }
+        responderPendentes(indice);
+        {
+            lock_guard<mutex> guarda(trava);
+            concluidas++;
+        }
+        loteConcluido.notify_one();
+    }
+}
+
+void ExecutorConsultas::concluir(EscritorSaida& saida) {
+    if (total == 0) return;
+
+    // O lote é publicado sob a trava, então as auxiliares enxergam as
+    // tarefas e os índices como a fase 1 os deixou
+    {
+        lock_guard<mutex> guarda(trava);
+        proxima.store(0);
+        concluidas = 0;
+        geracao++;
+    }
+    lotePublicado.notify_all();
+    responderPendentes(0);
+    {
+        unique_lock<mutex> guarda(trava);
+        loteConcluido.wait(guarda, [&] { return concluidas == totalAuxiliares; });
+    }
+    if (Instrumentacao* instrumentacao = simulador.getInstrumentacao()) {
+        for (int i = 0; i <= totalAuxiliares; i++) {
+            instrumentacao->juntar(medidas[i]);
+            medidas[i] = Instrumentacao();
+        }
+    }
+
+    for (int i = 0; i < total; i++) {
+        saida.escreverTexto(tarefas[i].texto.getDados(), tarefas[i].texto.getUsado());
+    }
+    total = 0;
+
+    if (!falha.empty()) {
+        string mensagem = falha;
+        falha.clear();
+        throw runtime_error("Erro ao responder consulta: " + mensagem);
+    }
+}
@@ -0,0 +1,197 @@
+#include "FormatoBinario.h"
+#include "Checksum.h"
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+static_assert(sizeof(CabecalhoBinario) == 56, "layout do cabecalho binario mudou");
+
+static uint32_t crcDoCabecalho(const CabecalhoBinario& cabecalho) {
+    return calcularCrc32(&cabecalho, offsetof(CabecalhoBinario, crcCabecalho));
+}
+
+static void escreverEm(int fd, const void* dados, size_t tamanho, off_t posicao) {
+    const char* p = static_cast<const char*>(dados);
+    while (tamanho > 0) {
+        ssize_t n = pwrite(fd, p, tamanho, posicao);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw runtime_error(string("Erro ao gravar o arquivo: ") + strerror(errno));
+        }
+        p += n;
+        posicao += n;
+        tamanho -= static_cast<size_t>(n);
+    }
+}
+
+// ---- GravadorBinario ----
+
+GravadorBinario::GravadorBinario(const string& nomeArquivo, const char magica[8],
+                                 uint32_t versaoFormato, uint32_t tamanhoRegistro)
+    : nomeArquivo(nomeArquivo), temporario(nomeArquivo + ".tmp"), fd(-1), escritor(nullptr),
+      bytesRegistros(0), concluido(false) {
+    fd = open(temporario.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw runtime_error("Erro ao criar o arquivo: " + temporario);
+    }
+    escritor = new EscritorSaida(fd);
+
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magica, magica, sizeof(cabecalho.magica));
+    cabecalho.versaoFormato = versaoFormato;
+    cabecalho.tamanhoRegistro = tamanhoRegistro;
+
+    // O cabeçalho só é conhecido no fim: as seções vão depois do espaço
+    // reservado para ele, que é preenchido em concluir()
+    escritor->escreverTexto(reinterpret_cast<const char*>(&cabecalho), sizeof(cabecalho));
+}
+
+GravadorBinario::~GravadorBinario() {
+    if (concluido) return;
+    escritor->limpar();
+    delete escritor;
+    close(fd);
+    unlink(temporario.c_str());
+}
+
+void GravadorBinario::escreverNomes(const TabelaNomes& nomes) {
+    uint64_t bytes = 0;
+    uint32_t crc = 0;
+    for (int id = 0; id < nomes.tamanho(); id++) {
+        const string& nome = nomes.getNome(id);
+        uint32_t tamanho = static_cast<uint32_t>(nome.size());
+        escritor->escreverTexto(reinterpret_cast<const char*>(&tamanho), sizeof(tamanho));
+        escritor->escreverTexto(nome.data(), nome.size());
+        crc = calcularCrc32(&tamanho, sizeof(tamanho), crc);
+        crc = calcularCrc32(nome.data(), nome.size(), crc);
+        bytes += sizeof(tamanho) + nome.size();
+    }
+    static const char ZEROS[8] = {0};
+    size_t preenchimento = (8 - bytes % 8) % 8;
+    escritor->escreverTexto(ZEROS, preenchimento);
+
+    cabecalho.totalNomes = static_cast<uint64_t>(nomes.tamanho());
+    cabecalho.bytesNomes = bytes + preenchimento;
+    cabecalho.crcNomes = calcularCrc32(ZEROS, preenchimento, crc);
+}
+
+void GravadorBinario::escreverRegistro(const void* registro) {
+    escreverRegistro(registro, cabecalho.tamanhoRegistro);
+}
+
+void GravadorBinario::escreverRegistro(const void* registro, size_t tamanho) {
+    escritor->escreverTexto(static_cast<const char*>(registro), tamanho);
+    cabecalho.crcRegistros = calcularCrc32(registro, tamanho, cabecalho.crcRegistros);
+    cabecalho.totalRegistros++;
+    bytesRegistros += tamanho;
+}
+
+void GravadorBinario::concluir() {
+    escritor->descarregar();
+    cabecalho.crcCabecalho = crcDoCabecalho(cabecalho);
+    escreverEm(fd, &cabecalho, sizeof(cabecalho), 0);
+    if (fsync(fd) != 0) {
+        throw runtime_error(string("Erro ao gravar o arquivo: ") + strerror(errno));
+    }
+    if (rename(temporario.c_str(), nomeArquivo.c_str()) != 0) {
+        throw runtime_error("Erro ao renomear " + temporario + " para " + nomeArquivo);
+    }
+    concluido = true;
+    delete escritor;
+    close(fd);
+}
+
+uint64_t GravadorBinario::getTamanho() const {
+    return sizeof(CabecalhoBinario) + cabecalho.bytesNomes + bytesRegistros;
+}
+
+// ---- LeitorBinario ----
+
+LeitorBinario::LeitorBinario(const string& nomeArquivo, const char magica[8], uint32_t versaoFormato,
+                             uint32_t tamanhoRegistro, const char* descricao)
+    : arquivo(nomeArquivo), cabecalho(nullptr), registros(nullptr), inicioNomes(nullptr) {
+    const string erro = string(descricao) + " invalido (" + nomeArquivo + "): ";
+    size_t tamanho = arquivo.getTamanho();
+    if (tamanho < sizeof(CabecalhoBinario)) {
+        throw runtime_error(erro + "arquivo menor que o cabecalho");
+    }
+
+    cabecalho = reinterpret_cast<const CabecalhoBinario*>(arquivo.getInicio());
+    if (memcmp(cabecalho->magica, magica, sizeof(cabecalho->magica)) != 0) {
+        throw runtime_error(erro + "assinatura nao reconhecida");
+    }
+    if (cabecalho->crcCabecalho != crcDoCabecalho(*cabecalho)) {
+        throw runtime_error(erro + "checksum do cabecalho nao confere");
+    }
+    if (cabecalho->versaoFormato != versaoFormato) {
+        throw runtime_error(erro + "versao de formato " + to_string(cabecalho->versaoFormato) + " nao suportada");
+    }
+    if (cabecalho->tamanhoRegistro != tamanhoRegistro) {
+        throw runtime_error(erro + "tamanho de registro incompativel");
+    }
+
+    // Confere o tamanho antes de tocar nas seções, sem estourar nas contas.
+    // Registros variáveis só são conferidos pelo checksum e por quem os lê.
+    size_t restante = tamanho - sizeof(CabecalhoBinario);
+    if (cabecalho->bytesNomes % 8 != 0 || cabecalho->bytesNomes > restante) {
+        throw runtime_error(erro + "tamanho do arquivo nao confere com o cabecalho");
+    }
+    size_t bytesRegistros = restante - cabecalho->bytesNomes;
+    if (tamanhoRegistro != REGISTRO_VARIAVEL &&
+        (bytesRegistros % tamanhoRegistro != 0 || cabecalho->totalRegistros != bytesRegistros / tamanhoRegistro)) {
+        throw runtime_error(erro + "tamanho do arquivo nao confere com o cabecalho");
+    }
+
+    const char* nomes = arquivo.getInicio() + sizeof(CabecalhoBinario);
+    registros = nomes + cabecalho->bytesNomes;
+
+    if (calcularCrc32(nomes, cabecalho->bytesNomes) != cabecalho->crcNomes) {
+        throw runtime_error(erro + "checksum dos nomes nao confere");
+    }
+    if (calcularCrc32(registros, bytesRegistros) != cabecalho->crcRegistros) {
+        throw runtime_error(erro + "checksum dos registros nao confere");
+    }
+
+    // Cada nome precisa caber na seção; guarda onde começa para getNome()
+    if (cabecalho->totalNomes > cabecalho->bytesNomes / sizeof(uint32_t)) {
+        throw runtime_error(erro + "secao de nomes truncada");
+    }
+    inicioNomes = new const char*[cabecalho->totalNomes + 1];
+    size_t cursor = 0;
+    bool truncada = false;
+    for (uint64_t i = 0; i < cabecalho->totalNomes && !truncada; i++) {
+        uint32_t tamanhoNome;
+        if (cabecalho->bytesNomes - cursor < sizeof(tamanhoNome)) {
+            truncada = true;
+            break;
+        }
+        memcpy(&tamanhoNome, nomes + cursor, sizeof(tamanhoNome));
+        inicioNomes[i] = nomes + cursor;
+        cursor += sizeof(tamanhoNome);
+        truncada = cabecalho->bytesNomes - cursor < tamanhoNome;
+        cursor += tamanhoNome;
+    }
+    if (truncada) {
+        delete[] inicioNomes;
+        throw runtime_error(erro + "secao de nomes truncada");
+    }
+}
+
+LeitorBinario::~LeitorBinario() {
+    delete[] inicioNomes;
+}
+
+Fatia LeitorBinario::getNome(long long id) const {
+    uint32_t tamanho;
+    memcpy(&tamanho, inicioNomes[id], sizeof(tamanho));
+    return Fatia(inicioNomes[id] + sizeof(tamanho), static_cast<int>(tamanho));
+}
+
+bool LeitorBinario::reconhecer(const char* inicio, size_t tamanho, const char magica[8]) {
+    return tamanho >= sizeof(CabecalhoBinario) && memcmp(inicio, magica, 8) == 0;
+}
@@ -0,0 +1,64 @@
+#include "HistogramaLatencia.h"
+#include <iomanip>
+
+using namespace std;
+
+HistogramaLatencia::HistogramaLatencia() : total(0), maximo(0), soma(0) {
+    for (int i = 0; i < FAIXAS; i++) contagens[i] = 0;
+}
+
+// Valores abaixo de SUBDIVISOES têm uma faixa cada; acima, a posição do bit
+// mais alto escolhe a potência e os 4 bits seguintes, a subdivisão
+int HistogramaLatencia::faixa(long long nanossegundos) {
+    if (nanossegundos < SUBDIVISOES) return nanossegundos < 0 ? 0 : static_cast<int>(nanossegundos);
+    int expoente = 63 - __builtin_clzll(static_cast<unsigned long long>(nanossegundos));
+    int subdivisao = static_cast<int>((nanossegundos >> (expoente - 4)) & (SUBDIVISOES - 1));
+    int indice = (expoente - 3) * SUBDIVISOES + subdivisao;
+    return indice < FAIXAS ? indice : FAIXAS - 1;
+}
+
+long long HistogramaLatencia::limiteSuperior(int faixa) {
+    if (faixa < SUBDIVISOES) return faixa;
+    int expoente = faixa / SUBDIVISOES + 3;
+    long long largura = 1LL << (expoente - 4);
+    return (SUBDIVISOES + faixa % SUBDIVISOES) * largura + largura - 1;
+}
+
+void HistogramaLatencia::registrar(long long nanossegundos) {
+    contagens[faixa(nanossegundos)]++;
+    total++;
+    soma += nanossegundos;
+    if (nanossegundos > maximo) maximo = nanossegundos;
+}
+
+void HistogramaLatencia::juntar(const HistogramaLatencia& outro) {
+    for (int i = 0; i < FAIXAS; i++) contagens[i] += outro.contagens[i];
+    total += outro.total;
+    soma += outro.soma;
+    if (outro.maximo > maximo) maximo = outro.maximo;
+}
+
+long long HistogramaLatencia::percentil(double p) const {
+    if (total == 0) return 0;
+    long long alvo = static_cast<long long>(p / 100.0 * total + 0.5);
+    if (alvo < 1) alvo = 1;
+    long long acumulado = 0;
+    for (int i = 0; i < FAIXAS; i++) {
+        acumulado += contagens[i];
+        if (acumulado >= alvo) {
+            long long limite = limiteSuperior(i);
+            return limite < maximo ? limite : maximo;
+        }
+    }
+    return maximo;
+}
+
+void HistogramaLatencia::imprimir(ostream& saida, const char* rotulo) const {
+    streamsize precisao = saida.precision();
+    saida << fixed << setprecision(1);
+    saida << rotulo << ": " << total << " amostras, media " << getMedia() / 1e3
+          << " us, p50 " << percentil(50) / 1e3 << " us, p99 " << percentil(99) / 1e3
+          << " us, max " << maximo / 1e3 << " us" << endl;
+    saida.unsetf(ios::floatfield);
+    saida.precision(precisao);
+}
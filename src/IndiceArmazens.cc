@@ -0,0 +1,72 @@
+#include "IndiceArmazens.h"
+
+IndiceArmazens::IndiceArmazens() : armazens(nullptr), capacidade(0) {}
+
+IndiceArmazens::~IndiceArmazens() {
+    for (int i = 0; i < capacidade; i++) {
+        delete armazens[i];
+    }
+    delete[] armazens;
+}
+
+// Aumenta a tabela de armazéns até comportar a posição pedida
+void IndiceArmazens::garantirCapacidade(int posicao) {
+    if (posicao < capacidade) return;
+
+    int novaCapacidade = capacidade ? capacidade : 16;
+    while (novaCapacidade <= posicao) novaCapacidade *= 2;
+
+    EventosArmazem** novos = new EventosArmazem*[novaCapacidade];
+    for (int i = 0; i < novaCapacidade; i++) {
+        novos[i] = (i < capacidade) ? armazens[i] : nullptr;
+    }
+    delete[] armazens;
+    armazens = novos;
+    capacidade = novaCapacidade;
+}
+
+void IndiceArmazens::indexar(int idArmazem, Evento* ev) {
+    if (idArmazem < -1) return; // IDs inválidos não são indexados
+    int posicao = idArmazem + 1;
+    garantirCapacidade(posicao);
+    if (!armazens[posicao]) {
+        armazens[posicao] = new EventosArmazem();
+    }
+    EventosArmazem& armazem = *armazens[posicao];
+    if (armazem.eventos.aceitaNoFim(ev)) {
+        armazem.eventos.inserirOrdenado(ev); // Só anexa
+        return;
+    }
+    armazem.atrasados.inserirOrdenado(ev);
+    if (armazem.atrasados.getTamanho() >= limiteAtrasados(armazem.eventos.getTamanho())) {
+        armazem.eventos.mesclar(armazem.atrasados);
+    }
+}
+
+// Tamanho do run lateral que dispara a mescla: a menor potência de 2 (a
+// partir de MINIMO_ATRASADOS) cujo quadrado cobre o vetor do armazém
+int IndiceArmazens::limiteAtrasados(int tamanho) {
+    int limite = MINIMO_ATRASADOS;
+    while (static_cast<long long>(limite) * limite < tamanho) limite *= 2;
+    return limite;
+}
+
+// Indexa o evento na origem e, se diferente, também no destino
+void IndiceArmazens::inserir(Evento* ev) {
+    indexar(ev->armazemOrigem, ev);
+    if (ev->armazemDestino != ev->armazemOrigem) {
+        indexar(ev->armazemDestino, ev);
+    }
+}
+
+const VetorEventos* IndiceArmazens::getEventos(int idArmazem) const {
+    int posicao = idArmazem + 1;
+    if (idArmazem < -1 || posicao >= capacidade || !armazens[posicao]) return nullptr;
+    return &armazens[posicao]->eventos;
+}
+
+const VetorEventos* IndiceArmazens::getAtrasados(int idArmazem) const {
+    int posicao = idArmazem + 1;
+    if (idArmazem < -1 || posicao >= capacidade || !armazens[posicao]) return nullptr;
+    return &armazens[posicao]->atrasados;
+}
@@ -0,0 +1,82 @@
+#include "Instrumentacao.h"
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+using namespace std;
+
+#ifdef TP3_ESTATISTICAS
+// operator new/delete substituídos só para contar; a memória vem do malloc,
+// como no padrão. Contadores relaxados: as threads de leitura também alocam.
+static atomic<long long> alocacoes(0);
+static atomic<long long> liberacoes(0);
+static atomic<long long> bytesAlocados(0);
+
+void* operator new(size_t tamanho) {
+    alocacoes.fetch_add(1, memory_order_relaxed);
+    bytesAlocados.fetch_add(static_cast<long long>(tamanho), memory_order_relaxed);
+    void* memoria = malloc(tamanho ? tamanho : 1);
+    if (!memoria) throw bad_alloc();
+    return memoria;
+}
+
+void operator delete(void* memoria) noexcept {
+    if (!memoria) return;
+    liberacoes.fetch_add(1, memory_order_relaxed);
+    free(memoria);
+}
+
+void operator delete(void* memoria, size_t) noexcept {
+    operator delete(memoria);
+}
+
+bool Instrumentacao::disponivel() { return true; }
+long long Instrumentacao::getAlocacoes() { return alocacoes.load(memory_order_relaxed); }
+long long Instrumentacao::getLiberacoes() { return liberacoes.load(memory_order_relaxed); }
+long long Instrumentacao::getBytesAlocados() { return bytesAlocados.load(memory_order_relaxed); }
+#else
+bool Instrumentacao::disponivel() { return false; }
+long long Instrumentacao::getAlocacoes() { return 0; }
+long long Instrumentacao::getLiberacoes() { return 0; }
+long long Instrumentacao::getBytesAlocados() { return 0; }
+#endif
+
+static const char* NOMES_ETAPAS[TOTAL_ETAPAS] = {
+    "interpretar", "evento/pacote", "evento/indice", "evento/historico", "evento/clientes",
+    "evento/rotas", "consulta PC", "consulta CL", "consulta MA", "consulta RC"
+};
+
+static const char* NOMES_EVENTOS[] = {"RG", "AR", "RM", "UR", "TR", "EN"};
+
+Instrumentacao::Instrumentacao() : consultasInvalidas(0) {
+    for (int i = 0; i < TIPOS_EVENTO; i++) eventosPorTipo[i] = 0;
+}
+
+void Instrumentacao::juntar(const Instrumentacao& outra) {
+    for (int i = 0; i < TOTAL_ETAPAS; i++) etapas[i].juntar(outra.etapas[i]);
+    for (int i = 0; i < TIPOS_EVENTO; i++) eventosPorTipo[i] += outra.eventosPorTipo[i];
+    consultasInvalidas += outra.consultasInvalidas;
+}
+
+void Instrumentacao::imprimir(ostream& saida) const {
+    streamsize precisao = saida.precision();
+    saida << "Estatisticas (tempos em ns):" << endl;
+    saida << fixed << setprecision(0);
+    for (int i = 0; i < TOTAL_ETAPAS; i++) {
+        const HistogramaLatencia& h = etapas[i];
+        saida << "  " << left << setw(18) << NOMES_ETAPAS[i] << right << setw(12) << h.getTotal()
+              << " amostras, total " << setw(12) << h.getMedia() * h.getTotal()
+              << ", media " << setw(8) << h.getMedia() << ", p50 " << setw(8) << h.percentil(50)
+              << ", p99 " << setw(8) << h.percentil(99) << ", max " << setw(10) << h.getMaximo() << endl;
+    }
+    saida.unsetf(ios::floatfield);
+    saida.precision(precisao);
+
+    saida << "  eventos:";
+    for (int i = 0; i < TIPOS_EVENTO; i++) saida << " " << NOMES_EVENTOS[i] << " " << eventosPorTipo[i];
+    saida << endl;
+    saida << "  consultas invalidas: " << consultasInvalidas << endl;
+    saida << "  alocacoes: " << getAlocacoes() << " new (" << getBytesAlocados() << " bytes), "
+          << getLiberacoes() << " delete" << endl;
+}
@@ -0,0 +1,249 @@
+#include "KernelsSimd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Versões escalares (também tratam as sobras das versões vetoriais)
+
+static int contarArmazemEscalar(const int* origens, const int* destinos, int n, int id) {
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        total += (origens[i] == id) | (destinos[i] == id);
+    }
+    return total;
+}
+
+static int filtrarArmazemEscalar(const int* origens, const int* destinos, int n, int id, int* indices) {
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        indices[total] = i;
+        total += (origens[i] == id) | (destinos[i] == id);
+    }
+    return total;
+}
+
+// Como os valores estão ordenados, a versão escalar pode parar no primeiro
+// valor fora do limite
+static int contarMenoresEscalar(const int* valores, int n, int limite) {
+    int i = 0;
+    while (i < n && valores[i] < limite) i++;
+    return i;
+}
+
+static int contarMenoresOuIguaisEscalar(const int* valores, int n, int limite) {
+    int i = 0;
+    while (i < n && valores[i] <= limite) i++;
+    return i;
+}
+
+#ifdef KERNELS_X86
+
+// ---------------------------------------------------------------------------
+// SSE2: 4 linhas por comparação. Nem toda CPU com SSE2 tem POPCNT, então as
+// máscaras de 4 bits são contadas por tabela.
+
+static const int BITS_EM_4[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+__attribute__((target("sse2")))
+static int contarArmazemSse2(const int* origens, const int* destinos, int n, int id) {
+    __m128i alvo = _mm_set1_epi32(id);
+    int total = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origens + i));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destinos + i));
+        __m128i igual = _mm_or_si128(_mm_cmpeq_epi32(o, alvo), _mm_cmpeq_epi32(d, alvo));
+        total += BITS_EM_4[_mm_movemask_ps(_mm_castsi128_ps(igual))];
+    }
+    return total + contarArmazemEscalar(origens + i, destinos + i, n - i, id);
+}
+
+__attribute__((target("sse2")))
+static int filtrarArmazemSse2(const int* origens, const int* destinos, int n, int id, int* indices) {
+    __m128i alvo = _mm_set1_epi32(id);
+    int total = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origens + i));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destinos + i));
+        __m128i igual = _mm_or_si128(_mm_cmpeq_epi32(o, alvo), _mm_cmpeq_epi32(d, alvo));
+        unsigned mascara = _mm_movemask_ps(_mm_castsi128_ps(igual));
+        while (mascara) {
+            indices[total++] = i + __builtin_ctz(mascara);
+            mascara &= mascara - 1;
+        }
+    }
+    int resto = filtrarArmazemEscalar(origens + i, destinos + i, n - i, id, indices + total);
+    for (int k = 0; k < resto; k++) indices[total + k] += i;
+    return total + resto;
+}
+
+__attribute__((target("sse2")))
+static int contarMenoresSse2(const int* valores, int n, int limite) {
+    __m128i alvo = _mm_set1_epi32(limite);
+    int total = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(valores + i));
+        total += BITS_EM_4[_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, alvo)))];
+    }
+    return total + contarMenoresEscalar(valores + i, n - i, limite);
+}
+
+__attribute__((target("sse2")))
+static int contarMenoresOuIguaisSse2(const int* valores, int n, int limite) {
+    __m128i alvo = _mm_set1_epi32(limite);
+    int total = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(valores + i));
+        // v <= limite  <=>  !(v > limite)
+        unsigned maiores = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, alvo)));
+        total += 4 - BITS_EM_4[maiores];
+    }
+    return total + contarMenoresOuIguaisEscalar(valores + i, n - i, limite);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2: 8 linhas por comparação (toda CPU com AVX2 também tem POPCNT)
+
+__attribute__((target("avx2,popcnt")))
+static int contarArmazemAvx2(const int* origens, const int* destinos, int n, int id) {
+    __m256i alvo = _mm256_set1_epi32(id);
+    int total = 0;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origens + i));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destinos + i));
+        __m256i igual = _mm256_or_si256(_mm256_cmpeq_epi32(o, alvo), _mm256_cmpeq_epi32(d, alvo));
+        total += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(igual)));
+    }
+    return total + contarArmazemEscalar(origens + i, destinos + i, n - i, id);
+}
+
+__attribute__((target("avx2,popcnt")))
+static int filtrarArmazemAvx2(const int* origens, const int* destinos, int n, int id, int* indices) {
+    __m256i alvo = _mm256_set1_epi32(id);
+    int total = 0;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origens + i));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destinos + i));
+        __m256i igual = _mm256_or_si256(_mm256_cmpeq_epi32(o, alvo), _mm256_cmpeq_epi32(d, alvo));
+        unsigned mascara = _mm256_movemask_ps(_mm256_castsi256_ps(igual));
+        while (mascara) {
+            indices[total++] = i + __builtin_ctz(mascara);
+            mascara &= mascara - 1;
+        }
+    }
+    int resto = filtrarArmazemEscalar(origens + i, destinos + i, n - i, id, indices + total);
+    for (int k = 0; k < resto; k++) indices[total + k] += i;
+    return total + resto;
+}
+
+__attribute__((target("avx2,popcnt")))
+static int contarMenoresAvx2(const int* valores, int n, int limite) {
+    __m256i alvo = _mm256_set1_epi32(limite);
+    int total = 0;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(valores + i));
+        total += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(alvo, v))));
+    }
+    return total + contarMenoresEscalar(valores + i, n - i, limite);
+}
+
+__attribute__((target("avx2,popcnt")))
+static int contarMenoresOuIguaisAvx2(const int* valores, int n, int limite) {
+    __m256i alvo = _mm256_set1_epi32(limite);
+    int total = 0;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(valores + i));
+        unsigned maiores = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, alvo)));
+        total += 8 - __builtin_popcount(maiores);
+    }
+    return total + contarMenoresOuIguaisEscalar(valores + i, n - i, limite);
+}
+
+#endif // KERNELS_X86
+
+// ---------------------------------------------------------------------------
+// Despacho
+
+struct TabelaKernels {
+    int (*contarArmazem)(const int*, const int*, int, int);
+    int (*filtrarArmazem)(const int*, const int*, int, int, int*);
+    int (*contarMenores)(const int*, int, int);
+    int (*contarMenoresOuIguais)(const int*, int, int);
+};
+
+static const TabelaKernels KERNELS_ESCALARES = {
+    contarArmazemEscalar, filtrarArmazemEscalar, contarMenoresEscalar, contarMenoresOuIguaisEscalar
+};
+#ifdef KERNELS_X86
+static const TabelaKernels KERNELS_SSE2 = {
+    contarArmazemSse2, filtrarArmazemSse2, contarMenoresSse2, contarMenoresOuIguaisSse2
+};
+static const TabelaKernels KERNELS_AVX2 = {
+    contarArmazemAvx2, filtrarArmazemAvx2, contarMenoresAvx2, contarMenoresOuIguaisAvx2
+};
+#endif
+
+NivelSimd detectarNivelSimd() {
+#ifdef KERNELS_X86
+    __builtin_cpu_init(); // Necessário se chamado antes de main
+    if (__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2")) return SIMD_SSE2;
+#endif
+    return SIMD_ESCALAR;
+}
+
+static const TabelaKernels* tabelaDoNivel(NivelSimd nivel) {
+#ifdef KERNELS_X86
+    if (nivel == SIMD_AVX2) return &KERNELS_AVX2;
+    if (nivel == SIMD_SSE2) return &KERNELS_SSE2;
+#endif
+    return &KERNELS_ESCALARES;
+}
+
+static NivelSimd nivelAtual = detectarNivelSimd();
+static const TabelaKernels* kernels = tabelaDoNivel(nivelAtual);
+
+void selecionarNivelSimd(NivelSimd nivel) {
+    NivelSimd maximo = detectarNivelSimd();
+    if (nivel > maximo) nivel = maximo;
+    nivelAtual = nivel;
+    kernels = tabelaDoNivel(nivel);
+}
+
+NivelSimd getNivelSimd() {
+    return nivelAtual;
+}
+
+const char* getNomeNivelSimd(NivelSimd nivel) {
+    switch (nivel) {
+        case SIMD_AVX2: return "avx2";
+        case SIMD_SSE2: return "sse2";
+        default: return "escalar";
+    }
+}
+
+int contarArmazem(const int* origens, const int* destinos, int n, int idArmazem) {
+    return kernels->contarArmazem(origens, destinos, n, idArmazem);
+}
+
+int filtrarArmazem(const int* origens, const int* destinos, int n, int idArmazem, int* indices) {
+    return kernels->filtrarArmazem(origens, destinos, n, idArmazem, indices);
+}
+
+int contarMenores(const int* valores, int n, int limite) {
+    return kernels->contarMenores(valores, n, limite);
+}
+
+int contarMenoresOuIguais(const int* valores, int n, int limite) {
+    return kernels->contarMenoresOuIguais(valores, n, limite);
+}
@@ -0,0 +1,265 @@
+#include "LeitorEntrada.h"
+#include <stdexcept>
+#include <climits>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// ---- ArquivoMapeado ----
+
+ArquivoMapeado::ArquivoMapeado(const std::string& nomeArquivo) : dados(nullptr), tamanho(0), mapeado(false) {
+    int fd = open(nomeArquivo.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Erro ao abrir o arquivo: " + nomeArquivo);
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        tamanho = static_cast<size_t>(info.st_size);
+        if (tamanho == 0) {
+            close(fd);
+            return;
+        }
+        void* mapa = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapa != MAP_FAILED) {
+            madvise(mapa, tamanho, MADV_SEQUENTIAL);
+            dados = static_cast<char*>(mapa);
+            mapeado = true;
+            close(fd);
+            return;
+        }
+    }
+
+    // Não foi possível mapear: lê tudo para um buffer que cresce sob demanda
+    size_t capacidade = 1 << 16;
+    tamanho = 0;
+    dados = static_cast<char*>(malloc(capacidade));
+    ssize_t lidos;
+    while (dados && (lidos = read(fd, dados + tamanho, capacidade - tamanho)) > 0) {
+        tamanho += static_cast<size_t>(lidos);
+        if (tamanho == capacidade) {
+            capacidade *= 2;
+            char* maior = static_cast<char*>(realloc(dados, capacidade));
+            if (!maior) break;
+            dados = maior;
+        }
+    }
+    close(fd);
+    if (!dados) {
+        throw std::runtime_error("Memoria insuficiente para ler o arquivo: " + nomeArquivo);
+    }
+}
+
+ArquivoMapeado::~ArquivoMapeado() {
+    if (mapeado) {
+        munmap(dados, tamanho);
+    } else {
+        free(dados);
+    }
+}
+
+const char* ArquivoMapeado::getInicio() const { return dados; }
+const char* ArquivoMapeado::getFim() const { return dados + tamanho; }
+size_t ArquivoMapeado::getTamanho() const { return tamanho; }
+
+// ---- Conversão dos campos ----
+
+// Percorre os campos de uma linha imitando a leitura com >> de um istringstream:
+// depois da primeira falha, as leituras seguintes não alteram mais os valores.
+struct Campos {
+    const char* p;
+    const char* fim;
+    bool falhou;
+
+    Campos(const Fatia& linha) : p(linha.inicio), fim(linha.inicio + linha.tamanho), falhou(false) {}
+
+    void pularEspacos() {
+        while (p < fim && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    }
+
+    bool lerInteiro(int& valor) {
+        if (falhou) return false;
+        pularEspacos();
+        if (p == fim) {
+            falhou = true;
+            return false;
+        }
+
+        const char* q = p;
+        bool negativo = false;
+        if (*q == '-' || *q == '+') {
+            negativo = (*q == '-');
+            q++;
+        }
+        if (q == fim || *q < '0' || *q > '9') {
+            valor = 0;
+            falhou = true;
+            return false;
+        }
+
+        long long acumulado = 0;
+        bool estourou = false;
+        while (q < fim && *q >= '0' && *q <= '9') {
+            if (!estourou) {
+                acumulado = acumulado * 10 + (*q - '0');
+                if (acumulado > static_cast<long long>(INT_MAX) + 1) estourou = true;
+            }
+            q++;
+        }
+        p = q;
+
+        if (estourou || (!negativo && acumulado > INT_MAX)) {
+            valor = negativo ? INT_MIN : INT_MAX;
+            falhou = true;
+            return false;
+        }
+        valor = static_cast<int>(negativo ? -acumulado : acumulado);
+        return true;
+    }
+
+    bool lerToken(Fatia& token) {
+        if (falhou) return false;
+        pularEspacos();
+        if (p == fim) {
+            falhou = true;
+            return false;
+        }
+        const char* inicio = p;
+        while (p < fim && *p != ' ' && *p != '\t' && *p != '\r') p++;
+        token = Fatia(inicio, static_cast<int>(p - inicio));
+        return true;
+    }
+};
+
+// Junta dois caracteres em um inteiro, para despachar comandos com um switch
+static inline int codigo(char a, char b) {
+    return (static_cast<unsigned char>(a) << 8) | static_cast<unsigned char>(b);
+}
+
+static TipoEvento lerTipoEvento(const Fatia& token) {
+    if (token.tamanho == 2) {
+        switch (codigo(token.inicio[0], token.inicio[1])) {
+            case ('R' << 8) | 'G': return RG;
+            case ('A' << 8) | 'R': return AR;
+            case ('R' << 8) | 'M': return RM;
+            case ('U' << 8) | 'R': return UR;
+            case ('T' << 8) | 'R': return TR;
+            case ('E' << 8) | 'N': return EN;
+        }
+    }
+    throw std::runtime_error("Tipo de evento invalido: " + token.str());
+}
+
+// ---- LeitorEntrada ----
+
+LeitorEntrada::LeitorEntrada(const char* inicio, const char* fim) : cursor(inicio), fim(fim), numeroLinha(0) {}
+
+bool LeitorEntrada::proximaLinha(Fatia& linha) {
+    while (cursor < fim) {
+        const char* inicio = cursor;
+        const char* quebra = static_cast<const char*>(memchr(cursor, '\n', fim - cursor));
+        const char* fimLinha = quebra ? quebra : fim;
+        cursor = quebra ? quebra + 1 : fim;
+        numeroLinha++;
+
+        if (fimLinha > inicio) {
+            linha = Fatia(inicio, static_cast<int>(fimLinha - inicio));
+            return true;
+        }
+    }
+    return false;
+}
+
+int LeitorEntrada::getNumeroLinha() const {
+    return numeroLinha;
+}
+
+void LeitorEntrada::interpretar(const Fatia& linha, LinhaEntrada& saida) {
+    saida.tipo = LINHA_IGNORADA;
+
+    Campos campos(linha);
+    int tempo;
+    Fatia comando;
+    if (!campos.lerInteiro(tempo) || !campos.lerToken(comando) || comando.tamanho != 2) {
+        return; // Linhas sem tempo ou com comando desconhecido são ignoradas
+    }
+
+    int cmd = codigo(comando.inicio[0], comando.inicio[1]);
+    if (cmd == (('E' << 8) | 'V')) {
+        Evento& ev = saida.evento;
+        Fatia tipoTexto;
+        campos.lerToken(tipoTexto);
+        int idPacote = -1;
+        bool temId = campos.lerInteiro(idPacote);
+        ev.tipo = lerTipoEvento(tipoTexto);
+        if (!temId) {
+            throw std::runtime_error("ID do pacote ausente no evento: " + linha.str());
+        }
+
+        ev.tempo = tempo;
+        ev.idPacote = idPacote;
+        ev.armazemOrigem = ev.armazemDestino = ev.secaoDestino = -1;
+        saida.remetente = saida.destinatario = Fatia();
+
+        switch (ev.tipo) {
+            case RG:
+                campos.lerToken(saida.remetente);
+                campos.lerToken(saida.destinatario);
+                campos.lerInteiro(ev.armazemOrigem);
+                campos.lerInteiro(ev.armazemDestino);
+                break;
+            case AR:
+                campos.lerInteiro(ev.armazemOrigem);
+                campos.lerInteiro(ev.armazemDestino);
+                campos.lerInteiro(ev.secaoDestino);
+                break;
+            case RM:
+            case UR:
+            case TR:
+                campos.lerInteiro(ev.armazemOrigem);
+                campos.lerInteiro(ev.armazemDestino);
+                break;
+            case EN:
+                campos.lerInteiro(ev.armazemDestino);
+                break;
+        }
+        saida.tipo = LINHA_EVENTO;
+        return;
+    }
+
+    Consulta& consulta = saida.consulta;
+    consulta = Consulta();
+    consulta.tempo = tempo;
+    consulta.linha = linha;
+
+    int valor;
+    switch (cmd) {
+        case ('P' << 8) | 'C':
+            consulta.tipo = CONSULTA_PC;
+            consulta.camposCompletos = campos.lerInteiro(consulta.idPacote);
+            break;
+        case ('C' << 8) | 'L':
+            consulta.tipo = CONSULTA_CL;
+            consulta.camposCompletos = campos.lerToken(consulta.nomeCliente);
+            break;
+        case ('M' << 8) | 'A':
+            consulta.tipo = CONSULTA_MA;
+            consulta.camposCompletos = campos.lerInteiro(consulta.tempoInicio) &&
+                                       campos.lerInteiro(consulta.tempoFim) &&
+                                       campos.lerInteiro(consulta.idArmazem);
+            break;
+        case ('R' << 8) | 'C':
+            consulta.tipo = CONSULTA_RC;
+            consulta.camposCompletos = true;
+            if (campos.lerInteiro(valor)) { // "RC k" é opcional
+                consulta.limite = valor;
+                consulta.camposCompletos = valor >= 0;
+            }
+            break;
+        default:
+            return;
+    }
+    saida.tipo = LINHA_CONSULTA;
+}
@@ -0,0 +1,82 @@
+#include "LeitorFluxo.h"
+#include <cerrno>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+using namespace std;
+
+LeitorFluxo::LeitorFluxo(int fd, size_t capacidade)
+    : fd(fd), buffer(new char[capacidade]), capacidade(capacidade), inicio(0), usado(0),
+      terminou(false), descartando(false), numeroLinha(0), bytesLidos(0) {}
+
+LeitorFluxo::~LeitorFluxo() {
+    delete[] buffer;
+}
+
+bool LeitorFluxo::proximaLinha(Fatia& linha) {
+    while (inicio < usado) {
+        const char* comeco = buffer + inicio;
+        const char* quebra = static_cast<const char*>(memchr(comeco, '\n', usado - inicio));
+        if (!quebra && !terminou) {
+            // Linha incompleta: espera o resto, a não ser que esteja sendo descartada
+            if (descartando) inicio = usado;
+            return false;
+        }
+
+        const char* fimLinha = quebra ? quebra : buffer + usado;
+        inicio = quebra ? static_cast<size_t>(quebra - buffer) + 1 : usado;
+        if (descartando) {
+            // Fim da linha longa demais, já contada e avisada em ler()
+            descartando = false;
+            continue;
+        }
+        numeroLinha++;
+        if (fimLinha > comeco) {
+            linha = Fatia(comeco, static_cast<int>(fimLinha - comeco));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LeitorFluxo::ler() {
+    if (terminou) return false;
+
+    // Traz o pedaço de linha que sobrou para o começo do buffer
+    if (inicio > 0) {
+        memmove(buffer, buffer + inicio, usado - inicio);
+        usado -= inicio;
+        inicio = 0;
+    }
+    if (usado == capacidade) {
+        usado = 0;
+        descartando = true;
+        numeroLinha++;
+        throw runtime_error("Linha maior que o buffer de entrada (" + to_string(capacidade) + " bytes); descartada");
+    }
+
+    ssize_t n;
+    do {
+        n = read(fd, buffer + usado, capacidade - usado);
+    } while (n < 0 && errno == EINTR);
+    if (n < 0) {
+        terminou = true; // Não há como continuar
+        throw runtime_error(string("Erro ao ler a entrada: ") + strerror(errno));
+    }
+    if (n == 0) {
+        terminou = true;
+    } else {
+        usado += static_cast<size_t>(n);
+        bytesLidos += n;
+    }
+    return true;
+}
+
+void EstatisticasFluxo::imprimir(ostream& saida) const {
+    saida << "Fluxo: " << linhas << " linhas, " << consultas << " consultas, " << bytes << " bytes em "
+          << leituras << " leituras, " << segundosTotal << " s" << endl;
+    latencias.imprimir(saida, "  latencia consulta->resposta");
+}
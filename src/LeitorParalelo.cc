@@ -0,0 +1,155 @@
+#include "LeitorParalelo.h"
+#include "Instrumentacao.h"
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+LoteLinhas::LoteLinhas()
+    : linhas(nullptr), numeros(nullptr), totalLinhas(0), capacidadeLinhas(0),
+      erros(nullptr), totalErros(0), capacidadeErros(0), linhasLidas(0) {}
+
+LoteLinhas::~LoteLinhas() {
+    delete[] linhas;
+    delete[] numeros;
+    delete[] erros;
+}
+
+void LoteLinhas::interpretar(const char* inicio, const char* fim, bool medir) {
+    totalLinhas = 0;
+    totalErros = 0;
+    INSTRUMENTAR(if (medir) interpretacao = HistogramaLatencia());
+
+    LeitorEntrada leitor(inicio, fim);
+    Fatia texto;
+    while (leitor.proximaLinha(texto)) {
+        if (totalLinhas == capacidadeLinhas) {
+            int novaCapacidade = capacidadeLinhas ? capacidadeLinhas * 2 : 4096;
+            LinhaEntrada* novasLinhas = new LinhaEntrada[novaCapacidade];
+            int* novosNumeros = new int[novaCapacidade];
+            for (int i = 0; i < totalLinhas; i++) {
+                novasLinhas[i] = linhas[i];
+                novosNumeros[i] = numeros[i];
+            }
+            delete[] linhas;
+            delete[] numeros;
+            linhas = novasLinhas;
+            numeros = novosNumeros;
+            capacidadeLinhas = novaCapacidade;
+        }
+
+        try {
+            INSTRUMENTAR(auto comeco = medir ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point());
+            LeitorEntrada::interpretar(texto, linhas[totalLinhas]);
+            INSTRUMENTAR(if (medir) interpretacao.registrar(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - comeco).count()));
+        } catch (const std::exception& e) {
+            if (totalErros == capacidadeErros) {
+                int novaCapacidade = capacidadeErros ? capacidadeErros * 2 : 16;
+                ErroLinha* novos = new ErroLinha[novaCapacidade];
+                for (int i = 0; i < totalErros; i++) novos[i] = erros[i];
+                delete[] erros;
+                erros = novos;
+                capacidadeErros = novaCapacidade;
+            }
+            erros[totalErros].indice = totalLinhas;
+            erros[totalErros].numeroLinha = leitor.getNumeroLinha();
+            erros[totalErros].mensagem = e.what();
+            totalErros++;
+            continue;
+        }
+
+        if (linhas[totalLinhas].tipo != LINHA_IGNORADA) {
+            numeros[totalLinhas] = leitor.getNumeroLinha();
+            totalLinhas++;
+        }
+    }
+    linhasLidas = leitor.getNumeroLinha();
+}
+
+LeitorParalelo::LeitorParalelo(const char* inicio, const char* fim, int numThreads, bool medir)
+    : totalTrechos(0), totalThreads(numThreads), medir(medir), proximoTrecho(0), consumidos(0), entregue(false) {
+    // Corta o buffer a cada TAMANHO_TRECHO bytes, avançando até a quebra de linha
+    size_t tamanho = fim - inicio;
+    int maximoTrechos = static_cast<int>(tamanho / TAMANHO_TRECHO) + 2;
+    inicioTrechos = new const char*[maximoTrechos];
+    const char* cursor = inicio;
+    while (cursor < fim) {
+        inicioTrechos[totalTrechos++] = cursor;
+        if (static_cast<size_t>(fim - cursor) <= TAMANHO_TRECHO) {
+            cursor = fim;
+        } else {
+            const char* quebra = static_cast<const char*>(
+                memchr(cursor + TAMANHO_TRECHO, '\n', fim - cursor - TAMANHO_TRECHO));
+            cursor = quebra ? quebra + 1 : fim;
+        }
+    }
+    inicioTrechos[totalTrechos] = fim;
+
+    totalLotes = 2 * totalThreads;
+    lotes = new LoteLinhas[totalLotes];
+    trechoDoLote = new int[totalLotes];
+    for (int i = 0; i < totalLotes; i++) trechoDoLote[i] = -1;
+
+    threads = new std::thread[totalThreads];
+    for (int i = 0; i < totalThreads; i++) {
+        threads[i] = std::thread(&LeitorParalelo::trabalhar, this);
+    }
+}
+
+LeitorParalelo::~LeitorParalelo() {
+    {
+        // Libera as threads que esperam por lotes que não serão mais consumidos
+        std::lock_guard<std::mutex> guarda(trava);
+        consumidos = totalTrechos;
+        proximoTrecho = totalTrechos;
+    }
+    loteLiberado.notify_all();
+    for (int i = 0; i < totalThreads; i++) {
+        threads[i].join();
+    }
+    delete[] threads;
+    delete[] lotes;
+    delete[] trechoDoLote;
+    delete[] inicioTrechos;
+}
+
+void LeitorParalelo::trabalhar() {
+    std::unique_lock<std::mutex> guarda(trava);
+    while (true) {
+        if (proximoTrecho >= totalTrechos) return;
+        int trecho = proximoTrecho++;
+
+        // Espera o lote deste trecho ser liberado por quem consome
+        while (trecho >= consumidos + totalLotes) {
+            loteLiberado.wait(guarda);
+        }
+        if (consumidos >= totalTrechos) return; // Leitor sendo destruído
+
+        int indice = trecho % totalLotes;
+        guarda.unlock();
+        lotes[indice].interpretar(inicioTrechos[trecho], inicioTrechos[trecho + 1], medir);
+        guarda.lock();
+
+        trechoDoLote[indice] = trecho;
+        lotePronto.notify_all();
+    }
+}
+
+const LoteLinhas* LeitorParalelo::proximoLote() {
+    std::unique_lock<std::mutex> guarda(trava);
+    if (entregue) {
+        // Lote devolvido na chamada anterior: libera para o trecho consumidos + totalLotes
+        trechoDoLote[consumidos % totalLotes] = -1;
+        consumidos++;
+        entregue = false;
+        loteLiberado.notify_all();
+    }
+    if (consumidos >= totalTrechos) return nullptr;
+
+    int indice = consumidos % totalLotes;
+    while (trechoDoLote[indice] != consumidos) {
+        lotePronto.wait(guarda);
+    }
+    entregue = true;
+    return &lotes[indice];
+}
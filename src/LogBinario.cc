@@ -0,0 +1,308 @@
+#include "LogBinario.h"
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+const char MAGICA_LOG[8] = {'T', 'P', '3', 'L', 'O', 'G', '\0', '\0'};
+
+// Inteiros com sinal passam por zigzag (0, -1, 1, -2... viram 0, 1, 2, 3...),
+// para que os -1 dos campos ausentes também ocupem um só byte
+static uint32_t paraZigzag(int32_t valor) {
+    return (static_cast<uint32_t>(valor) << 1) ^ static_cast<uint32_t>(valor >> 31);
+}
+
+static int32_t deZigzag(uint32_t valor) {
+    return static_cast<int32_t>((valor >> 1) ^ (0u - (valor & 1)));
+}
+
+// 7 bits por byte, o bit alto indica que há mais bytes
+static unsigned char* escreverVarint(unsigned char* destino, uint32_t valor) {
+    while (valor >= 0x80) {
+        *destino++ = static_cast<unsigned char>(valor | 0x80);
+        valor >>= 7;
+    }
+    *destino++ = static_cast<unsigned char>(valor);
+    return destino;
+}
+
+static uint32_t lerVarint(const unsigned char*& cursor, const unsigned char* fim) {
+    uint32_t valor = 0;
+    for (int deslocamento = 0; deslocamento < 35; deslocamento += 7) {
+        if (cursor == fim) {
+            throw runtime_error("Log binario truncado no meio de um registro");
+        }
+        unsigned char byte = *cursor++;
+        valor |= static_cast<uint32_t>(byte & 0x7f) << deslocamento;
+        if (!(byte & 0x80)) return valor;
+    }
+    throw runtime_error("Varint invalido no log binario");
+}
+
+void codificarRegistroLog(const LinhaEntrada& linha, TabelaNomes& nomes, RegistroLog& registro) {
+    registro = RegistroLog();
+    registro.idPacote = registro.remetente = registro.destinatario = -1;
+    registro.armazemOrigem = registro.armazemDestino = registro.secaoDestino = -1;
+
+    if (linha.tipo == LINHA_EVENTO) {
+        const Evento& ev = linha.evento;
+        registro.tempo = ev.tempo;
+        registro.tipo = ev.tipo;
+        registro.idPacote = ev.idPacote;
+        registro.armazemOrigem = ev.armazemOrigem;
+        registro.armazemDestino = ev.armazemDestino;
+        registro.secaoDestino = ev.secaoDestino;
+        if (ev.tipo == RG) {
+            registro.remetente = nomes.internar(linha.remetente.inicio, linha.remetente.tamanho);
+            registro.destinatario = nomes.internar(linha.destinatario.inicio, linha.destinatario.tamanho);
+        }
+        return;
+    }
+
+    const Consulta& consulta = linha.consulta;
+    registro.tempo = consulta.tempo;
+    if (!consulta.camposCompletos) {
+        registro.tipo = TIPO_REGISTRO_INCOMPLETA + consulta.tipo;
+        return;
+    }
+    registro.tipo = TIPO_REGISTRO_CONSULTA + consulta.tipo;
+    switch (consulta.tipo) {
+        case CONSULTA_PC:
+            registro.idPacote = consulta.idPacote;
+            break;
+        case CONSULTA_CL:
+            registro.remetente = nomes.internar(consulta.nomeCliente.inicio, consulta.nomeCliente.tamanho);
+            break;
+        case CONSULTA_MA:
+            registro.remetente = consulta.tempoInicio;
+            registro.destinatario = consulta.tempoFim;
+            registro.armazemOrigem = consulta.idArmazem;
+            break;
+        case CONSULTA_RC:
+            registro.idPacote = consulta.limite;
+            break;
+    }
+}
+
+size_t compactarRegistroLog(const RegistroLog& registro, int32_t tempoAnterior, unsigned char* destino) {
+    unsigned char* p = destino;
+    *p++ = static_cast<unsigned char>(registro.tipo);
+    // Diferença em aritmética módulo 2^32: qualquer par de tempos cabe
+    p = escreverVarint(p, paraZigzag(static_cast<int32_t>(static_cast<uint32_t>(registro.tempo) -
+                                                          static_cast<uint32_t>(tempoAnterior))));
+    switch (registro.tipo) {
+        case RG:
+            p = escreverVarint(p, paraZigzag(registro.idPacote));
+            p = escreverVarint(p, paraZigzag(registro.armazemOrigem));
+            p = escreverVarint(p, paraZigzag(registro.armazemDestino));
+            p = escreverVarint(p, static_cast<uint32_t>(registro.remetente));
+            p = escreverVarint(p, static_cast<uint32_t>(registro.destinatario));
+            break;
+        case AR:
+            p = escreverVarint(p, paraZigzag(registro.idPacote));
+            p = escreverVarint(p, paraZigzag(registro.armazemOrigem));
+            p = escreverVarint(p, paraZigzag(registro.armazemDestino));
+            p = escreverVarint(p, paraZigzag(registro.secaoDestino));
+            break;
+        case RM:
+        case UR:
+        case TR:
+            p = escreverVarint(p, paraZigzag(registro.idPacote));
+            p = escreverVarint(p, paraZigzag(registro.armazemOrigem));
+            p = escreverVarint(p, paraZigzag(registro.armazemDestino));
+            break;
+        case EN:
+            p = escreverVarint(p, paraZigzag(registro.idPacote));
+            p = escreverVarint(p, paraZigzag(registro.armazemDestino));
+            break;
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_PC:
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_RC:
+            p = escreverVarint(p, paraZigzag(registro.idPacote));
+            break;
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_CL:
+            p = escreverVarint(p, static_cast<uint32_t>(registro.remetente));
+            break;
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_MA:
+            p = escreverVarint(p, paraZigzag(registro.remetente));
+            p = escreverVarint(p, paraZigzag(registro.destinatario));
+            p = escreverVarint(p, paraZigzag(registro.armazemOrigem));
+            break;
+    }
+    return static_cast<size_t>(p - destino);
+}
+
+CursorLog::CursorLog(const LeitorBinario& log)
+    : atual(reinterpret_cast<const unsigned char*>(log.getInicioRegistros())),
+      fim(reinterpret_cast<const unsigned char*>(log.getFimRegistros())),
+      restantes(log.getTotalRegistros()), tempoAnterior(0) {}
+
+bool CursorLog::proximo(RegistroLog& registro) {
+    if (restantes == 0) {
+        if (atual != fim) {
+            throw runtime_error("Log binario com bytes alem do ultimo registro");
+        }
+        return false;
+    }
+    if (atual == fim) {
+        throw runtime_error("Log binario com menos registros que o cabecalho indica");
+    }
+
+    registro.tipo = *atual++;
+    registro.tempo = static_cast<int32_t>(static_cast<uint32_t>(tempoAnterior) +
+                                          static_cast<uint32_t>(deZigzag(lerVarint(atual, fim))));
+    registro.idPacote = registro.remetente = registro.destinatario = -1;
+    registro.armazemOrigem = registro.armazemDestino = registro.secaoDestino = -1;
+    switch (registro.tipo) {
+        case RG:
+            registro.idPacote = deZigzag(lerVarint(atual, fim));
+            registro.armazemOrigem = deZigzag(lerVarint(atual, fim));
+            registro.armazemDestino = deZigzag(lerVarint(atual, fim));
+            registro.remetente = static_cast<int32_t>(lerVarint(atual, fim));
+            registro.destinatario = static_cast<int32_t>(lerVarint(atual, fim));
+            break;
+        case AR:
+            registro.idPacote = deZigzag(lerVarint(atual, fim));
+            registro.armazemOrigem = deZigzag(lerVarint(atual, fim));
+            registro.armazemDestino = deZigzag(lerVarint(atual, fim));
+            registro.secaoDestino = deZigzag(lerVarint(atual, fim));
+            break;
+        case RM:
+        case UR:
+        case TR:
+            registro.idPacote = deZigzag(lerVarint(atual, fim));
+            registro.armazemOrigem = deZigzag(lerVarint(atual, fim));
+            registro.armazemDestino = deZigzag(lerVarint(atual, fim));
+            break;
+        case EN:
+            registro.idPacote = deZigzag(lerVarint(atual, fim));
+            registro.armazemDestino = deZigzag(lerVarint(atual, fim));
+            break;
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_PC:
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_RC:
+            registro.idPacote = deZigzag(lerVarint(atual, fim));
+            break;
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_CL:
+            registro.remetente = static_cast<int32_t>(lerVarint(atual, fim));
+            break;
+        case TIPO_REGISTRO_CONSULTA + CONSULTA_MA:
+            registro.remetente = deZigzag(lerVarint(atual, fim));
+            registro.destinatario = deZigzag(lerVarint(atual, fim));
+            registro.armazemOrigem = deZigzag(lerVarint(atual, fim));
+            break;
+        default:
+            // Consultas incompletas não têm campos; outro tipo deixaria o
+            // cursor perdido no meio da seção
+            if (registro.tipo < TIPO_REGISTRO_INCOMPLETA + CONSULTA_PC ||
+                registro.tipo > TIPO_REGISTRO_INCOMPLETA + CONSULTA_RC) {
+                throw runtime_error("Tipo de registro invalido: " + to_string(registro.tipo));
+            }
+            break;
+    }
+    tempoAnterior = registro.tempo;
+    restantes--;
+    return true;
+}
+
+static Fatia nomeDoLog(const LeitorBinario& log, int32_t id) {
+    if (id < 0 || id >= log.getTotalNomes()) {
+        throw runtime_error("ID de nome invalido no registro: " + to_string(id));
+    }
+    return log.getNome(id);
+}
+
+void decodificarRegistroLog(const RegistroLog& registro, const LeitorBinario& log, LinhaEntrada& linha) {
+    if (registro.tipo >= RG && registro.tipo <= EN) {
+        Evento& ev = linha.evento;
+        ev.tempo = registro.tempo;
+        ev.tipo = static_cast<TipoEvento>(registro.tipo);
+        ev.idPacote = registro.idPacote;
+        ev.armazemOrigem = registro.armazemOrigem;
+        ev.armazemDestino = registro.armazemDestino;
+        ev.secaoDestino = registro.secaoDestino;
+        ev.remetente = ev.destinatario = -1;
+        if (ev.tipo == RG) {
+            linha.remetente = nomeDoLog(log, registro.remetente);
+            linha.destinatario = nomeDoLog(log, registro.destinatario);
+        }
+        linha.tipo = LINHA_EVENTO;
+        return;
+    }
+
+    bool completa = registro.tipo < TIPO_REGISTRO_INCOMPLETA;
+    int tipoConsulta = registro.tipo - (completa ? TIPO_REGISTRO_CONSULTA : TIPO_REGISTRO_INCOMPLETA);
+    if (tipoConsulta < CONSULTA_PC || tipoConsulta > CONSULTA_RC) {
+        throw runtime_error("Tipo de registro invalido: " + to_string(registro.tipo));
+    }
+    Consulta& consulta = linha.consulta;
+    consulta = Consulta();
+    consulta.tempo = registro.tempo;
+    consulta.tipo = static_cast<TipoConsulta>(tipoConsulta);
+    consulta.camposCompletos = completa;
+    linha.tipo = LINHA_CONSULTA;
+    if (!completa) return;
+    switch (consulta.tipo) {
+        case CONSULTA_PC:
+            consulta.idPacote = registro.idPacote;
+            break;
+        case CONSULTA_CL:
+            consulta.nomeCliente = nomeDoLog(log, registro.remetente);
+            break;
+        case CONSULTA_MA:
+            consulta.tempoInicio = registro.remetente;
+            consulta.tempoFim = registro.destinatario;
+            consulta.idArmazem = registro.armazemOrigem;
+            break;
+        case CONSULTA_RC:
+            consulta.limite = registro.idPacote;
+            break;
+    }
+}
+
+// Duas passadas pela entrada mapeada: a primeira só monta o dicionário, que
+// vai antes dos registros; a segunda grava os registros, sem guardá-los em memória
+ResumoConversao converterParaLogBinario(const string& entrada, const string& saida) {
+    ArquivoMapeado arquivo(entrada);
+    TabelaNomes nomes;
+    Fatia texto;
+    LinhaEntrada linha;
+    RegistroLog registro;
+    unsigned char compacto[TAMANHO_MAXIMO_REGISTRO];
+    int32_t tempoAnterior = 0;
+
+    ResumoConversao resumo = ResumoConversao();
+    resumo.bytesEntrada = arquivo.getTamanho();
+
+    LeitorEntrada primeira(arquivo.getInicio(), arquivo.getFim());
+    while (primeira.proximaLinha(texto)) {
+        try {
+            LeitorEntrada::interpretar(texto, linha);
+            if (linha.tipo != LINHA_IGNORADA) codificarRegistroLog(linha, nomes, registro);
+        } catch (const std::exception&) {
+            // Avisado na segunda passada
+        }
+    }
+
+    GravadorBinario gravador(saida, MAGICA_LOG, VERSAO_LOG, REGISTRO_VARIAVEL);
+    gravador.escreverNomes(nomes);
+    LeitorEntrada segunda(arquivo.getInicio(), arquivo.getFim());
+    while (segunda.proximaLinha(texto)) {
+        resumo.linhas++;
+        try {
+            LeitorEntrada::interpretar(texto, linha);
+            if (linha.tipo == LINHA_IGNORADA) {
+                throw runtime_error("Linha nao reconhecida: " + texto.str());
+            }
+            codificarRegistroLog(linha, nomes, registro);
+            gravador.escreverRegistro(compacto, compactarRegistroLog(registro, tempoAnterior, compacto));
+            tempoAnterior = registro.tempo;
+            resumo.registros++;
+        } catch (const std::exception& e) {
+            cerr << "Aviso: linha " << segunda.getNumeroLinha() << " descartada na conversao: " << e.what() << endl;
+            resumo.descartadas++;
+        }
+    }
+    resumo.bytesSaida = gravador.getTamanho();
+    gravador.concluir();
+    return resumo;
+}
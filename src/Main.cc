@@ -1,23 +1,227 @@
 #include "Simulador.h"
+#include "LeitorEntrada.h"
+#include "PipelineCarga.h"
+#include "LogBinario.h"
+#include "LeitorFluxo.h"
 #include <iostream>
+#include <fstream>
 #include <string>
+#include <cstring>
+#include <chrono>
 #include <stdexcept>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <thread>
 
 using namespace std;
 
+// Mede a vazão apenas da leitura: mapeia o arquivo e interpreta todas as linhas
+// (ou decodifica todos os registros do log binário), sem aplicar nada ao
+// simulador. Retorna o tempo gasto em segundos.
+static double medirLeitura(const string& nomeArquivo, size_t& bytes) {
+    auto inicio = chrono::steady_clock::now();
+    ArquivoMapeado arquivo(nomeArquivo);
+    LinhaEntrada linha;
+    if (LeitorBinario::reconhecer(arquivo.getInicio(), arquivo.getTamanho(), MAGICA_LOG)) {
+        LeitorBinario log(nomeArquivo, MAGICA_LOG, VERSAO_LOG, REGISTRO_VARIAVEL, "Log binario");
+        CursorLog cursor(log);
+        RegistroLog registro;
+        while (cursor.proximo(registro)) {
+            try {
+                decodificarRegistroLog(registro, log, linha);
+            } catch (const std::exception&) {
+                // Registros inválidos são contados na carga completa
+            }
+        }
+    } else {
+        LeitorEntrada leitor(arquivo.getInicio(), arquivo.getFim());
+        Fatia texto;
+        while (leitor.proximaLinha(texto)) {
+            try {
+                LeitorEntrada::interpretar(texto, linha);
+            } catch (const std::exception&) {
+                // Linhas inválidas são contadas na carga completa
+            }
+        }
+    }
+    bytes = arquivo.getTamanho();
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+static void imprimirVazao(const char* rotulo, size_t bytes, double segundos) {
+    double megabytes = bytes / (1024.0 * 1024.0);
+    cerr << rotulo << ": " << megabytes << " MB em " << segundos << " s ("
+         << (segundos > 0 ? megabytes / segundos : 0) << " MB/s)" << endl;
+}
+
 int main(int argc, char** argv) {
-    if (argc < 2) {
-        cerr << "Uso: " << argv[0] << " <arquivo_de_entrada>" << endl;
+    bool vazao = false;
+    bool pipeline = false;
+    bool fluxo = false; // Lê a entrada aos poucos (obrigatório para stdin, pipes e FIFOs)
+    int threadsConsultas = 0; // > 0: consultas respondidas em lotes paralelos
+    const char* arquivo = nullptr;
+    const char* arquivoSaida = nullptr;
+    const char* snapshotEntrada = nullptr; // Restaurado antes da entrada
+    const char* snapshotSaida = nullptr;   // Gravado depois da entrada
+    const char* logBinario = nullptr;      // Só converte a entrada para este arquivo
+    bool estatisticas = false;             // --stats: resumo da instrumentação no fim
+    const char* arquivoEstatisticas = nullptr; // --stats=<arquivo>; senão, stderr
+    ModoEventos modoEventos = EVENTOS_COLUNAR;
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--vazao") == 0) {
+            vazao = true;
+        } else if (strcmp(argv[i], "--fluxo") == 0) {
+            fluxo = true;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            estatisticas = true;
+        } else if (strncmp(argv[i], "--stats=", 8) == 0) {
+            estatisticas = true;
+            arquivoEstatisticas = argv[i] + 8;
+        } else if (strcmp(argv[i], "--pipeline") == 0) {
+            pipeline = true;
+        } else if (strncmp(argv[i], "--eventos=", 10) == 0) {
+            const char* modo = argv[i] + 10;
+            if (strcmp(modo, "avl") == 0) {
+                modoEventos = EVENTOS_AVL;
+            } else if (strcmp(modo, "colunar") == 0) {
+                modoEventos = EVENTOS_COLUNAR;
+            } else {
+                cerr << "Modo de eventos invalido: " << modo << " (use avl ou colunar)" << endl;
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--consultas-paralelas") == 0 && i + 1 < argc) {
+            threadsConsultas = atoi(argv[++i]);
+            if (threadsConsultas < 1) threadsConsultas = 1;
+        } else if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc) {
+            snapshotEntrada = argv[++i];
+        } else if (strcmp(argv[i], "--gravar-snapshot") == 0 && i + 1 < argc) {
+            snapshotSaida = argv[++i];
+        } else if (strcmp(argv[i], "--converter") == 0 && i + 1 < argc) {
+            logBinario = argv[++i];
+        } else if (strcmp(argv[i], "--saida") == 0 && i + 1 < argc) {
+            arquivoSaida = argv[++i];
+        } else {
+            arquivo = argv[i];
+        }
+    }
+
+    // Sem a macro não há o que medir: recusa em vez de imprimir zeros
+    if (estatisticas && !Instrumentacao::disponivel()) {
+        cerr << "--stats indisponivel: compilado sem TP3_ESTATISTICAS (use make ESTATISTICAS=1)" << endl;
         return 1;
     }
 
+    // Com --snapshot, o arquivo de entrada é opcional
+    if (!arquivo && !snapshotEntrada) {
+        cerr << "Uso: " << argv[0] << " [--vazao] [--eventos=colunar|avl] [--threads N | --pipeline | --consultas-paralelas N | --fluxo]"
+             << " [--snapshot <arquivo>] [--gravar-snapshot <arquivo>] [--saida <arquivo>] [--stats[=<arquivo>]]"
+             << " <arquivo_de_entrada | ->" << endl;
+        cerr << "     " << argv[0] << " --converter <log_binario> <arquivo_de_entrada>" << endl;
+        return 1;
+    }
+
+    // "-" é a entrada padrão, sempre lida em fluxo; FIFOs, dispositivos e
+    // sockets dados pelo caminho também, pois não podem ser mapeados
+    if (arquivo && strcmp(arquivo, "-") == 0) fluxo = true;
+    struct stat info;
+    if (arquivo && !fluxo && stat(arquivo, &info) == 0 &&
+        (S_ISFIFO(info.st_mode) || S_ISCHR(info.st_mode) || S_ISSOCK(info.st_mode))) {
+        fluxo = true;
+    }
+
+    if (logBinario) {
+        if (!arquivo) {
+            cerr << "Informe o arquivo texto a converter" << endl;
+            return 1;
+        }
+        try {
+            ResumoConversao resumo = converterParaLogBinario(arquivo, logBinario);
+            cerr << "Convertidas " << resumo.registros << " de " << resumo.linhas << " linhas ("
+                 << resumo.descartadas << " descartadas): " << resumo.bytesEntrada << " -> "
+                 << resumo.bytesSaida << " bytes" << endl;
+        } catch (const std::exception& e) {
+            cerr << "Erro fatal durante a conversao: " << e.what() << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    int fdSaida = STDOUT_FILENO;
+    if (arquivoSaida) {
+        fdSaida = open(arquivoSaida, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fdSaida < 0) {
+            cerr << "Erro ao abrir o arquivo de saida: " << arquivoSaida << endl;
+            return 1;
+        }
+    }
+
+    int status = 0;
     try {
-        Simulador simulador;
-        simulador.carregarEventos(argv[1]);
+        if (vazao && arquivo && !fluxo) {
+            size_t bytes = 0;
+            double segundos = medirLeitura(arquivo, bytes);
+            imprimirVazao("Leitura", bytes, segundos);
+        }
+
+        Simulador simulador(fdSaida, modoEventos);
+        Instrumentacao instrumentacao;
+        if (estatisticas) simulador.ligarInstrumentacao(&instrumentacao);
+        if (snapshotEntrada) {
+            auto inicio = chrono::steady_clock::now();
+            simulador.restaurarSnapshot(snapshotEntrada);
+            if (vazao) {
+                double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+                imprimirVazao("Snapshot restaurado", simulador.getBytesLidos(), segundos);
+            }
+        }
+
+        if (arquivo && fluxo) {
+            // Com --vazao, a latência entre a chegada de cada consulta e sua resposta vai para stderr
+            int fdEntrada = STDIN_FILENO;
+            if (strcmp(arquivo, "-") != 0) {
+                fdEntrada = open(arquivo, O_RDONLY);
+                if (fdEntrada < 0) throw runtime_error(string("Erro ao abrir o arquivo: ") + arquivo);
+            }
+            EstatisticasFluxo estatisticasFluxo;
+            simulador.carregarFluxo(fdEntrada, &estatisticasFluxo);
+            if (fdEntrada != STDIN_FILENO) close(fdEntrada);
+            if (vazao) estatisticasFluxo.imprimir(cerr);
+        } else if (arquivo && pipeline) {
+            // Com --vazao, as latências das etapas e a ocupação das filas vão para stderr
+            EstatisticasPipeline estatisticasPipeline;
+            simulador.carregarEventosEmPipeline(arquivo, &estatisticasPipeline);
+            if (vazao) estatisticasPipeline.imprimir(cerr);
+        } else if (arquivo && threadsConsultas > 0) {
+            simulador.carregarEventosComConsultasParalelas(arquivo, threadsConsultas);
+        } else if (arquivo) {
+            simulador.carregarEventos(arquivo, threads);
+        }
+
+        if (snapshotSaida) {
+            simulador.salvarSnapshot(snapshotSaida);
+        }
+
+        if (vazao) {
+            imprimirVazao("Carga completa", simulador.getBytesLidos(), simulador.getSegundosCarga());
+        }
+
+        if (estatisticas && arquivoEstatisticas) {
+            ofstream arquivoResumo(arquivoEstatisticas);
+            if (!arquivoResumo) throw runtime_error(string("Erro ao criar o arquivo: ") + arquivoEstatisticas);
+            simulador.imprimirEstatisticas(arquivoResumo);
+        } else if (estatisticas) {
+            simulador.imprimirEstatisticas(cerr);
+        }
     } catch (const std::exception& e) {
         cerr << "Erro fatal durante a execucao: " << e.what() << endl;
-        return 1;
+        status = 1;
     }
 
-    return 0;
-}
\ No newline at end of file
+    if (arquivoSaida) close(fdSaida);
+    return status;
+}
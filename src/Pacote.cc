@@ -1,12 +1,86 @@
-
 #include "Pacote.h"
+#include "Cliente.h"
+
+Pacote::Pacote(int id)
+    : id(id), primeiroEvento(nullptr), ultimoEvento(nullptr), vinculadosExtras(nullptr), totalVinculados(0) {} // Inicializa ponteiros
 
-Pacote::Pacote(int id) : id(id), primeiroEvento(nullptr), ultimoEvento(nullptr) {} // Inicializa ponteiros
+Pacote::~Pacote() { delete[] vinculadosExtras; }
 
 int Pacote::getId() const { return id; }
 
 
 void Pacote::setPrimeiroEvento(Evento* ev) { this->primeiroEvento = ev; }
-void Pacote::setUltimoEvento(Evento* ev) { this->ultimoEvento = ev; }
+
+// Atualiza o último evento e propaga a troca para os resumos dos clientes
+void Pacote::setUltimoEvento(Evento* ev, long long versaoMinima) {
+    Evento* anterior = this->ultimoEvento;
+    this->ultimoEvento = ev;
+    for (int i = 0; i < totalVinculados; i++) {
+        ResumoCliente& resumo = getVinculado(i)->getResumo();
+        resumo.adicionar(ev, this, ev->sequencia, versaoMinima);
+        if (anterior && anterior != primeiroEvento) resumo.invalidar();
+    }
+}
+
 Evento* Pacote::getPrimeiroEvento() const { return this->primeiroEvento; }
-Evento* Pacote::getUltimoEvento() const { return this->ultimoEvento; }
\ No newline at end of file
+Evento* Pacote::getUltimoEvento() const { return this->ultimoEvento; }
+
+Evento* Pacote::getUltimoEventoNaVersao(long long versao) const {
+    if (!ultimoEvento || ultimoEvento->sequencia < versao) return ultimoEvento;
+    // O histórico está em ordem de chave, não de chegada: procura a maior
+    // sequência anterior à versão (pacotes têm poucos eventos)
+    Evento* ultimo = nullptr;
+    for (int i = 0; i < historico.getTamanho(); i++) {
+        Evento* ev = historico.get(i);
+        if (ev->sequencia < versao && (!ultimo || ev->sequencia > ultimo->sequencia)) ultimo = ev;
+    }
+    return ultimo;
+}
+
+// Registra o evento no histórico próprio do pacote
+void Pacote::adicionarEvento(Evento* ev) { historico.inserirOrdenado(ev); }
+const VetorEventos& Pacote::getHistorico() const { return historico; }
+
+int Pacote::getTotalVinculados() const { return totalVinculados; }
+
+Cliente* Pacote::getVinculado(int i) const {
+    return i < 2 ? vinculados[i] : vinculadosExtras[i - 2];
+}
+
+void Pacote::vincularCliente(Cliente* cliente, long long versaoMinima) {
+    for (int i = 0; i < totalVinculados; i++) {
+        if (getVinculado(i) == cliente) return;
+    }
+
+    if (totalVinculados < 2) {
+        vinculados[totalVinculados] = cliente;
+    } else {
+        // Pacote registrado mais de uma vez: cresce a lista extra um a um
+        Cliente** extras = new Cliente*[totalVinculados - 1];
+        for (int i = 2; i < totalVinculados; i++) extras[i - 2] = vinculadosExtras[i - 2];
+        extras[totalVinculados - 2] = cliente;
+        delete[] vinculadosExtras;
+        vinculadosExtras = extras;
+    }
+    totalVinculados++;
+
+    // As entradas passam a existir a partir do evento atual, que fez o vínculo
+    ResumoCliente& resumo = cliente->getResumo();
+    long long sequencia = ultimoEvento ? ultimoEvento->sequencia : 0;
+    if (primeiroEvento) resumo.adicionar(primeiroEvento, this, sequencia, versaoMinima);
+    if (ultimoEvento && ultimoEvento != primeiroEvento) resumo.adicionar(ultimoEvento, this, sequencia, versaoMinima);
+}
+
+void Pacote::restaurar(Evento* primeiro, Evento* ultimo, Evento* const* eventos, int totalHistorico,
+                       Cliente* const* clientes, int total) {
+    primeiroEvento = primeiro;
+    ultimoEvento = ultimo;
+    historico.atribuir(eventos, totalHistorico);
+    delete[] vinculadosExtras;
+    vinculadosExtras = total > 2 ? new Cliente*[total - 2] : nullptr;
+    for (int i = 0; i < total; i++) {
+        if (i < 2) vinculados[i] = clientes[i];
+        else vinculadosExtras[i - 2] = clientes[i];
+    }
+    totalVinculados = total;
+}
@@ -0,0 +1,190 @@
+#include "PipelineCarga.h"
+#include "Simulador.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+static double agora() {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+EstatisticasPipeline::EstatisticasPipeline() : segundosTotal(0) {
+    static const char* NOMES_ETAPAS[ETAPAS] = {"leitura", "aplicacao", "saida"};
+    static const char* NOMES_FILAS[FILAS] = {"lotes", "cabecalhos", "itens"};
+    for (int i = 0; i < ETAPAS; i++) {
+        etapas[i].nome = NOMES_ETAPAS[i];
+        etapas[i].itens = 0;
+        etapas[i].segundosTotal = 0;
+        etapas[i].segundosEsperando = 0;
+    }
+    for (int i = 0; i < FILAS; i++) {
+        filas[i].nome = NOMES_FILAS[i];
+        filas[i].capacidade = 0;
+        filas[i].insercoes = 0;
+        filas[i].ocupacaoMedia = 0;
+        filas[i].ocupacaoMaxima = 0;
+    }
+}
+
+// A etapa com mais tempo ocupado (total - esperando) é o gargalo
+void EstatisticasPipeline::imprimir(ostream& saida) const {
+    saida << fixed << setprecision(3);
+    saida << "Pipeline: " << segundosTotal << " s" << endl;
+    int gargalo = 0;
+    for (int i = 0; i < ETAPAS; i++) {
+        const EstatisticasEtapa& e = etapas[i];
+        double ocupada = e.segundosTotal - e.segundosEsperando;
+        if (ocupada > etapas[gargalo].segundosTotal - etapas[gargalo].segundosEsperando) gargalo = i;
+        saida << "  etapa " << setw(10) << left << e.nome << right
+              << " itens " << setw(10) << e.itens
+              << "  ocupada " << setw(8) << ocupada << " s"
+              << "  esperando " << setw(8) << e.segundosEsperando << " s"
+              << "  " << setw(8) << (e.itens ? ocupada * 1e6 / e.itens : 0) << " us/item" << endl;
+    }
+    for (int i = 0; i < FILAS; i++) {
+        const EstatisticasFila& f = filas[i];
+        saida << "  fila  " << setw(10) << left << f.nome << right
+              << " capacidade " << setw(6) << f.capacidade
+              << "  ocupacao media " << setw(8) << f.ocupacaoMedia
+              << "  maxima " << f.ocupacaoMaxima << endl;
+    }
+    saida << "  gargalo: " << etapas[gargalo].nome << endl;
+    saida.unsetf(ios::floatfield);
+}
+
+void PipelineCarga::DestinoFilas::iniciar(const CabecalhoResposta& cabecalho) {
+    pipeline.cabecalhos.inserir(cabecalho);
+}
+
+void PipelineCarga::DestinoFilas::adicionar(const ItemResposta& item) {
+    pipeline.itens.inserir(item);
+}
+
+PipelineCarga::PipelineCarga(Simulador& simulador, DestinoResposta& formatador)
+    : simulador(simulador), formatador(formatador),
+      lotesLivres(TOTAL_LOTES), lotesProntos(TOTAL_LOTES), cabecalhos(1024), itens(4096),
+      falhaSaida(false) {
+    for (int i = 0; i < TOTAL_LOTES; i++) {
+        lotesLivres.inserir(&lotes[i]);
+    }
+}
+
+// Etapa 1: corta a entrada em trechos terminados em quebra de linha
+void PipelineCarga::lerTrechos(const char* inicio, const char* fim) {
+    double comeco = agora();
+    const char* cursor = inicio;
+    while (cursor < fim) {
+        const char* fimTrecho = fim;
+        if (static_cast<size_t>(fim - cursor) > TAMANHO_TRECHO) {
+            const char* quebra = static_cast<const char*>(
+                memchr(cursor + TAMANHO_TRECHO, '\n', fim - cursor - TAMANHO_TRECHO));
+            fimTrecho = quebra ? quebra + 1 : fim;
+        }
+
+        LoteLinhas* lote;
+        lotesLivres.remover(lote);
+        lote->interpretar(cursor, fimTrecho, simulador.getInstrumentacao() != nullptr);
+        estatisticas.etapas[0].itens += lote->getLinhasLidas();
+        lotesProntos.inserir(lote);
+        cursor = fimTrecho;
+    }
+    lotesProntos.inserir(nullptr);
+
+    EstatisticasEtapa& etapa = estatisticas.etapas[0];
+    etapa.segundosTotal = agora() - comeco;
+    etapa.segundosEsperando = lotesLivres.getSegundosVazia() + lotesProntos.getSegundosCheia();
+}
+
+// Etapa 2: aplica as linhas na ordem do arquivo
+void PipelineCarga::aplicarLotes() {
+    double comeco = agora();
+    DestinoFilas destino(*this);
+    int linhaBase = 0;
+    while (true) {
+        LoteLinhas* lote;
+        lotesProntos.remover(lote);
+        if (!lote) break;
+
+        simulador.aplicarLote(*lote, linhaBase, destino);
+        linhaBase += lote->getLinhasLidas();
+        estatisticas.etapas[1].itens += lote->getTotalLinhas();
+        lotesLivres.inserir(lote);
+    }
+
+    CabecalhoResposta fimRespostas;
+    fimRespostas.valida = false;
+    fimRespostas.total = TOTAL_FIM;
+    cabecalhos.inserir(fimRespostas);
+
+    EstatisticasEtapa& etapa = estatisticas.etapas[1];
+    etapa.segundosTotal = agora() - comeco;
+    etapa.segundosEsperando = lotesProntos.getSegundosVazia() + cabecalhos.getSegundosCheia() + itens.getSegundosCheia();
+}
+
+// Etapa 3: formata as respostas. Se a escrita falhar, continua esvaziando
+// as filas para não travar a etapa 2, e o erro é relançado no fim.
+void PipelineCarga::escreverRespostas() {
+    double comeco = agora();
+    while (true) {
+        CabecalhoResposta cabecalho;
+        cabecalhos.remover(cabecalho);
+        if (cabecalho.total == TOTAL_FIM) break;
+
+        try {
+            if (!falhaSaida) formatador.iniciar(cabecalho);
+        } catch (const std::exception& e) {
+            falhaSaida = true;
+            mensagemFalhaSaida = e.what();
+        }
+        for (int i = 0; i < cabecalho.total; i++) {
+            ItemResposta item;
+            itens.remover(item);
+            try {
+                if (!falhaSaida) formatador.adicionar(item);
+            } catch (const std::exception& e) {
+                falhaSaida = true;
+                mensagemFalhaSaida = e.what();
+            }
+        }
+        estatisticas.etapas[2].itens++;
+    }
+
+    EstatisticasEtapa& etapa = estatisticas.etapas[2];
+    etapa.segundosTotal = agora() - comeco;
+    etapa.segundosEsperando = cabecalhos.getSegundosVazia() + itens.getSegundosVazia();
+}
+
+template <typename T>
+static void copiarEstatisticas(const FilaSpsc<T>& fila, EstatisticasFila& destino) {
+    destino.capacidade = fila.getCapacidade();
+    destino.insercoes = fila.getInsercoes();
+    destino.ocupacaoMedia = fila.getOcupacaoMedia();
+    destino.ocupacaoMaxima = fila.getMaximaOcupacao();
+}
+
+void PipelineCarga::executar(const char* inicio, const char* fim) {
+    double comeco = agora();
+    thread leitura(&PipelineCarga::lerTrechos, this, inicio, fim);
+    thread saida(&PipelineCarga::escreverRespostas, this);
+    aplicarLotes();
+    leitura.join();
+    saida.join();
+    estatisticas.segundosTotal = agora() - comeco;
+
+    copiarEstatisticas(lotesProntos, estatisticas.filas[0]);
+    copiarEstatisticas(cabecalhos, estatisticas.filas[1]);
+    copiarEstatisticas(itens, estatisticas.filas[2]);
+
+    if (falhaSaida) {
+        throw runtime_error(mensagemFalhaSaida);
+    }
+}
+
+const EstatisticasPipeline& PipelineCarga::getEstatisticas() const {
+    return estatisticas;
+}
@@ -0,0 +1,54 @@
+#include "RespostaConsulta.h"
+
+FormatadorResposta::FormatadorResposta(EscritorSaida& saida) : saida(saida) {}
+
+void FormatadorResposta::iniciar(const CabecalhoResposta& cabecalho) {
+    const Consulta& consulta = cabecalho.consulta;
+    saida.escreverInteiro(consulta.tempo, 7);
+    saida.escreverChar(' ');
+    saida.escreverTexto(consulta.getNomeTipo(), 2);
+    // Consulta malformada: a linha fica só com o tempo e o tipo, como antes
+    if (!cabecalho.valida) return;
+
+    switch (consulta.tipo) {
+        case CONSULTA_PC:
+            saida.escreverChar(' ');
+            saida.escreverInteiro(consulta.idPacote, 3);
+            break;
+        case CONSULTA_CL:
+            saida.escreverChar(' ');
+            saida.escreverTexto(consulta.nomeCliente.inicio, consulta.nomeCliente.tamanho);
+            break;
+        case CONSULTA_MA:
+            saida.escreverChar(' ');
+            saida.escreverInteiro(consulta.tempoInicio, 7);
+            saida.escreverChar(' ');
+            saida.escreverInteiro(consulta.tempoFim, 7);
+            saida.escreverChar(' ');
+            saida.escreverInteiro(consulta.idArmazem, 3);
+            break;
+        case CONSULTA_RC:
+            // "RC k" retorna apenas as k rotas mais usadas
+            if (consulta.limite >= 0) {
+                saida.escreverChar(' ');
+                saida.escreverInteiro(consulta.limite);
+            }
+            break;
+    }
+    saida.novaLinha();
+    saida.escreverInteiro(cabecalho.total);
+    saida.novaLinha();
+}
+
+void FormatadorResposta::adicionar(const ItemResposta& item) {
+    if (item.evento) {
+        escreverEvento(saida, *item.evento, item.remetente, item.destinatario);
+        return;
+    }
+    saida.escreverInteiro(item.origem, 3);
+    saida.escreverChar(' ');
+    saida.escreverInteiro(item.destino, 3);
+    saida.escreverChar(' ');
+    saida.escreverInteiro(item.contagem);
+    saida.novaLinha();
+}
@@ -0,0 +1,79 @@
+#include "ResumoCliente.h"
+
+ResumoCliente::ResumoCliente() : entradas(nullptr), tamanho(0), capacidade(0), vivos(0) {}
+
+ResumoCliente::~ResumoCliente() {
+    delete[] entradas;
+}
+
+void ResumoCliente::crescer() {
+    int novaCapacidade = capacidade ? capacidade * 2 : 4;
+    Entrada* novas = new Entrada[novaCapacidade];
+    for (int i = 0; i < tamanho; i++) {
+        novas[i] = entradas[i];
+    }
+    delete[] entradas;
+    entradas = novas;
+    capacidade = novaCapacidade;
+}
+
+// Remove as entradas obsoletas, preservando a ordem. Uma entrada inválida
+// na versão mínima nunca mais volta a valer; as criadas depois dela ficam.
+void ResumoCliente::compactar(long long versaoMinima) {
+    int destino = 0;
+    for (int i = 0; i < tamanho; i++) {
+        bool manter = versaoMinima == VERSAO_ATUAL ? valida(i)
+                      : entradas[i].sequencia >= versaoMinima || validaNaVersao(i, versaoMinima);
+        if (manter) entradas[destino++] = entradas[i];
+    }
+    tamanho = destino;
+}
+
+void ResumoCliente::adicionar(Evento* ev, const Pacote* pacote, long long sequencia, long long versaoMinima) {
+    if (tamanho == capacidade) {
+        // Só cresce se a maior parte das entradas ainda for válida (ou se a
+        // versão mínima impediu a compactação de liberar espaço)
+        if (tamanho - vivos >= tamanho / 2 && tamanho > 0) compactar(versaoMinima);
+        if (tamanho == capacidade) crescer();
+    }
+
+    ChaveEvento chave = gerarChaveEvento(*ev);
+    int pos = tamanho;
+    while (pos > 0 && gerarChaveEvento(*entradas[pos - 1].evento) > chave) {
+        entradas[pos] = entradas[pos - 1];
+        pos--;
+    }
+    entradas[pos].evento = ev;
+    entradas[pos].pacote = pacote;
+    entradas[pos].sequencia = sequencia;
+    tamanho++;
+    vivos++;
+}
+
+void ResumoCliente::restaurar(int total, int vivosSalvos) {
+    delete[] entradas;
+    entradas = total > 0 ? new Entrada[total] : nullptr;
+    capacidade = total;
+    tamanho = 0;
+    vivos = vivosSalvos;
+}
+
+void ResumoCliente::anexar(Evento* ev, const Pacote* pacote, long long sequencia) {
+    if (tamanho == capacidade) crescer();
+    entradas[tamanho].evento = ev;
+    entradas[tamanho].pacote = pacote;
+    entradas[tamanho].sequencia = sequencia;
+    tamanho++;
+}
+
+void ResumoCliente::invalidar() {
+    vivos--;
+}
+
+int ResumoCliente::getVivos() const {
+    return vivos;
+}
+
+int ResumoCliente::getTamanho() const {
+    return tamanho;
+}
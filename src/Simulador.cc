@@ -1,55 +1,544 @@
 #include "Simulador.h"
-#include <iomanip>
-#include <sstream>
-#include <fstream>
 #include <iostream>
 #include <stdexcept>
+#include <chrono>
 #include "ParPacoteString.h"
+#include "LeitorParalelo.h"
+#include "PipelineCarga.h"
+#include "ExecutorConsultas.h"
+#include "Snapshot.h"
+#include "LogBinario.h"
+#include "LeitorFluxo.h"
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 using namespace std;
 
-Simulador::Simulador() {}
+Simulador::Simulador(int fdSaida, ModoEventos modo)
+    : modoEventos(modo), proximaSequencia(0), versaoMinimaLeitura(VERSAO_ATUAL), saida(fdSaida), formatador(saida), bytesLidos(0), segundosCarga(0), instrumentacao(nullptr) {}
 
-// Destrutor robusto para limpar toda a memória alocada dinamicamente.
-Simulador::~Simulador()
-{
-    // Limpa todos os Eventos
-    auto limparEventos = [](Evento *e) { delete e; };
-    eventos.emOrdem(limparEventos);
+// Eventos, pacotes e clientes são liberados pelos pools, bloco a bloco.
+Simulador::~Simulador() {}
+
+static void avisarErroLinha(int numeroLinha, const char* mensagem) {
+    cerr << "Aviso: Erro ao processar a linha " << numeroLinha << ": " << mensagem << endl;
+}
 
-    // Limpa todos os Pacotes
-    auto limparPacotes = [](Pacote *p) { delete p; };
-    pacotes.emOrdem(limparPacotes);
+// O log binário só é aceito aqui; os outros modos de carga leem texto
+static void recusarLogBinario(const ArquivoMapeado& arquivo, const std::string& nomeArquivo) {
+    if (LeitorBinario::reconhecer(arquivo.getInicio(), arquivo.getTamanho(), MAGICA_LOG)) {
+        throw std::runtime_error("Log binario so e aceito na carga padrao: " + nomeArquivo);
+    }
 }
 
-void Simulador::carregarEventos(const std::string& nomeArquivo) {
-    ifstream arquivo(nomeArquivo);
-    if (!arquivo.is_open()) {
-        throw std::runtime_error("Erro ao abrir o arquivo: " + nomeArquivo);
+void Simulador::carregarEventos(const std::string& nomeArquivo, int threads) {
+    auto inicio = chrono::steady_clock::now();
+    ArquivoMapeado arquivo(nomeArquivo);
+    if (LeitorBinario::reconhecer(arquivo.getInicio(), arquivo.getTamanho(), MAGICA_LOG)) {
+        carregarLogBinario(nomeArquivo);
+        return;
     }
 
-    string linha;
-    int numeroLinha = 0;
-    while (getline(arquivo, linha)) {
-        numeroLinha++;
-        if (linha.empty()) {
+    if (threads <= 1) {
+        LeitorEntrada leitor(arquivo.getInicio(), arquivo.getFim());
+        Fatia texto;
+        LinhaEntrada linha;
+        while (leitor.proximaLinha(texto)) {
+            try {
+                INSTRUMENTAR(Cronometro cronometro(instrumentacao));
+                LeitorEntrada::interpretar(texto, linha);
+                INSTRUMENTAR(cronometro.marcar(ETAPA_INTERPRETAR));
+                processarLinha(linha);
+            } catch (const std::exception& e) {
+                avisarErroLinha(leitor.getNumeroLinha(), e.what());
+                // Continua o processamento das próximas linhas
+            }
+        }
+    } else {
+        // As threads só interpretam; as linhas são aplicadas aqui, na ordem do
+        // arquivo, então cada consulta vê exatamente os eventos anteriores a ela
+        LeitorParalelo leitor(arquivo.getInicio(), arquivo.getFim(), threads, instrumentacao != nullptr);
+        int linhaBase = 0;
+        const LoteLinhas* lote;
+        while ((lote = leitor.proximoLote()) != nullptr) {
+            aplicarLote(*lote, linhaBase, formatador);
+            linhaBase += lote->getLinhasLidas();
+        }
+    }
+    saida.descarregar();
+
+    bytesLidos += arquivo.getTamanho();
+    segundosCarga += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Os IDs de nome do log são traduzidos para os da TabelaNomes na primeira
+// vez que aparecem num RG. Os avisos numeram os registros a partir de 1.
+void Simulador::carregarLogBinario(const std::string& nomeArquivo) {
+    auto inicio = chrono::steady_clock::now();
+    LeitorBinario log(nomeArquivo, MAGICA_LOG, VERSAO_LOG, REGISTRO_VARIAVEL, "Log binario");
+    CursorLog cursor(log);
+
+    long long totalNomes = log.getTotalNomes();
+    int* idsNomes = new int[totalNomes > 0 ? totalNomes : 1];
+    for (long long i = 0; i < totalNomes; i++) idsNomes[i] = -1;
+
+    LinhaEntrada linha;
+    RegistroLog registro;
+    // Erros na estrutura da seção interrompem a carga; os de um registro só
+    // são avisados, como as linhas do texto
+    for (long long i = 0; cursor.proximo(registro); i++) {
+        try {
+            INSTRUMENTAR(Cronometro cronometro(instrumentacao));
+            decodificarRegistroLog(registro, log, linha);
+            INSTRUMENTAR(cronometro.marcar(ETAPA_INTERPRETAR));
+            if (linha.tipo == LINHA_EVENTO && linha.evento.tipo == RG) {
+                Evento evento = linha.evento;
+                int& remetente = idsNomes[registro.remetente];
+                if (remetente < 0) remetente = nomes.internar(linha.remetente.inicio, linha.remetente.tamanho);
+                int& destinatario = idsNomes[registro.destinatario];
+                if (destinatario < 0) destinatario = nomes.internar(linha.destinatario.inicio, linha.destinatario.tamanho);
+                evento.remetente = remetente;
+                evento.destinatario = destinatario;
+                processarEvento(evento);
+            } else {
+                processarLinha(linha);
+            }
+        } catch (const std::exception& e) {
+            avisarErroLinha(static_cast<int>(i + 1), e.what());
+        }
+    }
+    delete[] idsNomes;
+    saida.descarregar();
+
+    bytesLidos += log.getTamanho();
+    segundosCarga += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Processa as linhas que já chegaram e descarrega a saída antes de bloquear
+// em ler(), então cada resposta sai assim que sua linha é processada. Todas
+// as linhas de uma rodada foram completadas pela última leitura.
+void Simulador::carregarFluxo(int fd, EstatisticasFluxo* estatisticas) {
+    auto inicio = chrono::steady_clock::now();
+    LeitorFluxo leitor(fd);
+    EstatisticasFluxo locais;
+    EstatisticasFluxo& e = estatisticas ? *estatisticas : locais;
+
+    Fatia texto;
+    LinhaEntrada linha;
+    auto chegada = chrono::steady_clock::now();
+    while (true) {
+        long long consultas = 0;
+        while (leitor.proximaLinha(texto)) {
+            e.linhas++;
+            try {
+                INSTRUMENTAR(Cronometro cronometro(instrumentacao));
+                LeitorEntrada::interpretar(texto, linha);
+                INSTRUMENTAR(cronometro.marcar(ETAPA_INTERPRETAR));
+                if (linha.tipo == LINHA_CONSULTA) consultas++;
+                processarLinha(linha);
+            } catch (const std::exception& erro) {
+                avisarErroLinha(leitor.getNumeroLinha(), erro.what());
+            }
+        }
+        saida.descarregar();
+        if (consultas > 0) {
+            long long ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - chegada).count();
+            for (long long i = 0; i < consultas; i++) e.latencias.registrar(ns);
+            e.consultas += consultas;
+        }
+
+        try {
+            if (!leitor.ler()) break;
+        } catch (const std::exception& erro) {
+            avisarErroLinha(leitor.getNumeroLinha(), erro.what());
             continue;
         }
-        istringstream iss(linha);
-        int timestamp;
-        string comando;
-        iss >> timestamp >> comando;
+        chegada = chrono::steady_clock::now();
+        e.leituras++;
+    }
+
+    e.bytes = leitor.getBytesLidos();
+    bytesLidos += leitor.getBytesLidos();
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    e.segundosTotal = segundos;
+    segundosCarga += segundos;
+}
+
+// Leitura, aplicação e saída em três threads (ver PipelineCarga)
+void Simulador::carregarEventosEmPipeline(const std::string& nomeArquivo, EstatisticasPipeline* estatisticas) {
+    auto inicio = chrono::steady_clock::now();
+    ArquivoMapeado arquivo(nomeArquivo);
+    recusarLogBinario(arquivo, nomeArquivo);
+
+    PipelineCarga pipeline(*this, formatador);
+    pipeline.executar(arquivo.getInicio(), arquivo.getFim());
+    saida.descarregar();
+    if (estatisticas) *estatisticas = pipeline.getEstatisticas();
+
+    bytesLidos += arquivo.getTamanho();
+    segundosCarga += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Fase 1 aplica os eventos e adia as consultas; quando o lote de consultas
+// enche (ou muitos eventos se acumulam), a fase 2 responde a todas em
+// paralelo. RC depende do ranking atual, que não é versionado, e consultas
+// malformadas precisam avisar o erro na ordem: ambas respondem na hora.
+void Simulador::carregarEventosComConsultasParalelas(const std::string& nomeArquivo, int threads) {
+    // Limita o quanto os resumos de clientes podem crescer sem compactar
+    const long long EVENTOS_POR_LOTE = 1 << 16;
+
+    auto inicio = chrono::steady_clock::now();
+    ArquivoMapeado arquivo(nomeArquivo);
+    recusarLogBinario(arquivo, nomeArquivo);
+    ExecutorConsultas executor(*this, threads);
+
+    LeitorEntrada leitor(arquivo.getInicio(), arquivo.getFim());
+    Fatia texto;
+    LinhaEntrada linha;
+    versaoMinimaLeitura = proximaSequencia;
+    while (leitor.proximaLinha(texto)) {
         try {
-            if (comando == "PC" || comando == "CL" || comando == "MA" || comando == "RC") {
-                processarConsulta(linha); // Processa consultas
-            } else if (comando == "EV") {
-                processarEvento(Evento::lerEvento(linha)); // Processa eventos
+            INSTRUMENTAR(Cronometro cronometro(instrumentacao));
+            LeitorEntrada::interpretar(texto, linha);
+            INSTRUMENTAR(cronometro.marcar(ETAPA_INTERPRETAR));
+            if (linha.tipo == LINHA_EVENTO) {
+                processarLinha(linha);
+            } else if (linha.tipo == LINHA_CONSULTA) {
+                if (linha.consulta.camposCompletos && linha.consulta.tipo != CONSULTA_RC) {
+                    executor.adiar(linha.consulta, proximaSequencia);
+                } else {
+                    FormatadorResposta imediato(executor.responderAgora());
+                    avaliarConsultaNaVersao(linha.consulta, imediato, VERSAO_ATUAL, instrumentacao);
+                }
             }
         } catch (const std::exception& e) {
-            cerr << "Aviso: Erro ao processar a linha " << numeroLinha << ": " << e.what() << endl;
-            // Continua o processamento das próximas linhas
+            avisarErroLinha(leitor.getNumeroLinha(), e.what());
+        }
+
+        if (executor.cheio() || (executor.getTotal() > 0 && proximaSequencia - versaoMinimaLeitura >= EVENTOS_POR_LOTE)) {
+            prepararLeitura();
+            executor.concluir(saida);
+            versaoMinimaLeitura = proximaSequencia;
+        }
+    }
+    prepararLeitura();
+    executor.concluir(saida);
+    versaoMinimaLeitura = VERSAO_ATUAL;
+    saida.descarregar();
+
+    bytesLidos += arquivo.getTamanho();
+    segundosCarga += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Vetor temporário, liberado no fim do escopo (também se houver exceção)
+template <typename T>
+struct VetorTemporario {
+    T* dados;
+    explicit VetorTemporario(long long total) : dados(new T[total > 0 ? total : 1]) {}
+    ~VetorTemporario() { delete[] dados; }
+    VetorTemporario(const VetorTemporario&) = delete;
+    VetorTemporario& operator=(const VetorTemporario&) = delete;
+    T& operator[](long long i) { return dados[i]; }
+};
+
+// Índice do evento na seção de eventos do snapshot (-1 para nenhum)
+static int32_t indiceEvento(const Evento* ev) {
+    return ev ? static_cast<int32_t>(ev->sequencia) : -1;
+}
+
+static void copiarLista(const ListaInt& lista, int32_t* destino) {
+    for (ListaInt::Iterador it = lista.begin(); it.eValido(); ++it) {
+        *destino++ = *it;
+    }
+}
+
+// O estado é gravado como está montado (ver Snapshot.h): eventos, linhas e
+// colunas em ordem de chave, pacotes, clientes com seus resumos e rotas
+void Simulador::salvarSnapshot(const std::string& nomeArquivo) const {
+    long long totalEventos = proximaSequencia;
+    if (poolEventos.getTotalObjetos() != totalEventos || totalEventos > INT32_MAX) {
+        throw std::runtime_error("Estado inconsistente: eventos nao batem com a sequencia");
+    }
+    VetorTemporario<Evento*> porSequencia(totalEventos);
+    poolEventos.paraCada([&](Evento* ev) { porSequencia[ev->sequencia] = ev; });
+    VetorTemporario<RegistroEvento> registros(totalEventos);
+    for (long long i = 0; i < totalEventos; i++) {
+        registros[i] = paraRegistro(*porSequencia[i]);
+    }
+
+    // Linhas em ordem de chave: as colunas intercaladas com o run lateral,
+    // ou, no modo AVL, os eventos ordenados
+    VetorTemporario<int32_t> linhas(totalEventos);
+    if (modoEventos == EVENTOS_COLUNAR) {
+        int principais = eventosColunares.getTamanho() - eventosColunares.getTotalAtrasados();
+        int atrasados = eventosColunares.getTotalAtrasados();
+        int a = 0, b = 0;
+        for (long long i = 0; i < totalEventos; i++) {
+            bool principal = b == atrasados ||
+                (a < principais && gerarChaveEvento(*eventosColunares.getEvento(a)) <
+                                   gerarChaveEvento(*eventosColunares.getAtrasado(b)));
+            linhas[i] = indiceEvento(principal ? eventosColunares.getEvento(a++) : eventosColunares.getAtrasado(b++));
+        }
+    } else {
+        sort(porSequencia.dados, porSequencia.dados + totalEventos,
+             [](const Evento* x, const Evento* y) { return gerarChaveEvento(*x) < gerarChaveEvento(*y); });
+        for (long long i = 0; i < totalEventos; i++) {
+            linhas[i] = indiceEvento(porSequencia[i]);
+        }
+    }
+
+    long long totalPacotes = poolPacotes.getTotalObjetos(), totalHistoricos = 0, totalVinculos = 0;
+    poolPacotes.paraCada([&](Pacote* p) {
+        totalHistoricos += p->getHistorico().getTamanho();
+        totalVinculos += p->getTotalVinculados();
+    });
+    VetorTemporario<RegistroPacote> regPacotes(totalPacotes);
+    VetorTemporario<int32_t> historicos(totalHistoricos), vinculos(totalVinculos);
+    long long p = 0, h = 0, v = 0;
+    poolPacotes.paraCada([&](Pacote* pacote) {
+        RegistroPacote& r = regPacotes[p++];
+        const VetorEventos& historico = pacote->getHistorico();
+        r.id = pacote->getId();
+        r.primeiroEvento = indiceEvento(pacote->getPrimeiroEvento());
+        r.ultimoEvento = indiceEvento(pacote->getUltimoEvento());
+        r.totalHistorico = historico.getTamanho();
+        r.totalVinculados = pacote->getTotalVinculados();
+        r.reservado = 0;
+        for (int i = 0; i < historico.getTamanho(); i++) historicos[h++] = indiceEvento(historico.get(i));
+        for (int i = 0; i < r.totalVinculados; i++) vinculos[v++] = pacote->getVinculado(i)->getId();
+    });
+
+    long long totalClientes = poolClientes.getTotalObjetos(), totalPacotesClientes = 0, totalResumos = 0;
+    poolClientes.paraCada([&](Cliente* c) {
+        totalPacotesClientes += c->getPacotesRemetente().getTamanho() + c->getPacotesDestinatario().getTamanho();
+        totalResumos += c->getResumo().getTamanho();
+    });
+    VetorTemporario<RegistroCliente> regClientes(totalClientes);
+    VetorTemporario<int32_t> pacotesClientes(totalPacotesClientes);
+    VetorTemporario<RegistroResumo> resumos(totalResumos);
+    long long c = 0, pc = 0, rs = 0;
+    poolClientes.paraCada([&](Cliente* cliente) {
+        RegistroCliente& r = regClientes[c++];
+        const ResumoCliente& resumo = cliente->getResumo();
+        r.idNome = cliente->getId();
+        r.totalRemetente = cliente->getPacotesRemetente().getTamanho();
+        r.totalDestinatario = cliente->getPacotesDestinatario().getTamanho();
+        r.totalResumo = resumo.getTamanho();
+        r.vivos = resumo.getVivos();
+        r.reservado = 0;
+        copiarLista(cliente->getPacotesRemetente(), &pacotesClientes[pc]);
+        pc += r.totalRemetente;
+        copiarLista(cliente->getPacotesDestinatario(), &pacotesClientes[pc]);
+        pc += r.totalDestinatario;
+        for (int i = 0; i < resumo.getTamanho(); i++, rs++) {
+            resumos[rs].sequencia = resumo.getSequencia(i);
+            resumos[rs].evento = indiceEvento(resumo.getEvento(i));
+            resumos[rs].reservado = 0;
+        }
+    });
+
+    ListaRotas rotas = rotasCongestionadas.getRotasOrdenadas();
+    VetorTemporario<RegistroRota> regRotas(rotas.getTamanho());
+    long long totalRotas = 0;
+    for (ListaRotas::Iterador it = rotas.begin(); it.eValido(); ++it, totalRotas++) {
+        const Rota& rota = *it;
+        regRotas[totalRotas].origem = rota.origem;
+        regRotas[totalRotas].destino = rota.destino;
+        regRotas[totalRotas].contagem = rota.contagem;
+        regRotas[totalRotas].reservado = 0;
+    }
+
+    GravadorBinario gravador(nomeArquivo, MAGICA_SNAPSHOT, VERSAO_SNAPSHOT, REGISTRO_VARIAVEL);
+    gravador.escreverNomes(nomes);
+    gravarSecao(gravador, SECAO_EVENTOS, registros.dados, sizeof(RegistroEvento), totalEventos);
+    gravarSecao(gravador, SECAO_LINHAS, linhas.dados, sizeof(int32_t), totalEventos);
+    gravarSecao(gravador, SECAO_PACOTES, regPacotes.dados, sizeof(RegistroPacote), totalPacotes);
+    gravarSecao(gravador, SECAO_HISTORICOS, historicos.dados, sizeof(int32_t), totalHistoricos);
+    gravarSecao(gravador, SECAO_VINCULOS, vinculos.dados, sizeof(int32_t), totalVinculos);
+    gravarSecao(gravador, SECAO_CLIENTES, regClientes.dados, sizeof(RegistroCliente), totalClientes);
+    gravarSecao(gravador, SECAO_PACOTES_CLIENTES, pacotesClientes.dados, sizeof(int32_t), totalPacotesClientes);
+    gravarSecao(gravador, SECAO_RESUMOS, resumos.dados, sizeof(RegistroResumo), totalResumos);
+    gravarSecao(gravador, SECAO_ROTAS, regRotas.dados, sizeof(RegistroRota), totalRotas);
+    gravador.concluir();
+}
+
+// Os eventos do snapshot são copiados em bloco para dentro do pool
+static_assert(std::is_trivially_copyable<Evento>::value && sizeof(Evento) == sizeof(RegistroEvento) &&
+              offsetof(Evento, tempo) == offsetof(RegistroEvento, tempo) &&
+              offsetof(Evento, destinatario) == offsetof(RegistroEvento, destinatario) &&
+              offsetof(Evento, tipo) == offsetof(RegistroEvento, tipo) && sizeof(TipoEvento) == sizeof(int32_t),
+              "Evento e RegistroEvento precisam ter o mesmo layout");
+
+// Erro de dados inconsistentes no snapshot
+static void verificarSnapshot(bool condicao, const char* descricao) {
+    if (!condicao) throw std::runtime_error(std::string("Snapshot invalido: ") + descricao);
+}
+
+// Lê uma seção de índices, conferindo que cada um está em [0, limite)
+static const int32_t* lerIndices(LeitorSecoes& secoes, SecaoSnapshot secao, uint64_t& total, long long limite) {
+    const int32_t* indices = static_cast<const int32_t*>(secoes.ler(secao, sizeof(int32_t), total));
+    for (uint64_t i = 0; i < total; i++) {
+        verificarSnapshot(indices[i] >= 0 && indices[i] < limite, "indice fora do intervalo");
+    }
+    return indices;
+}
+
+void Simulador::restaurarSnapshot(const std::string& nomeArquivo) {
+    if (proximaSequencia != 0 || nomes.tamanho() != 0) {
+        throw std::runtime_error("O snapshot so pode ser restaurado num simulador vazio");
+    }
+    auto inicio = chrono::steady_clock::now();
+    LeitorBinario snapshot(nomeArquivo, MAGICA_SNAPSHOT, VERSAO_SNAPSHOT, REGISTRO_VARIAVEL, "Snapshot");
+
+    // Os nomes entram na mesma ordem, então recebem os mesmos IDs
+    for (long long id = 0; id < snapshot.getTotalNomes(); id++) {
+        Fatia nome = snapshot.getNome(id);
+        verificarSnapshot(nomes.internar(nome.inicio, nome.tamanho) == id, "nome repetido na tabela de nomes");
+    }
+    int totalNomes = nomes.tamanho();
+
+    LeitorSecoes secoes(snapshot);
+    uint64_t totalEventos, totalLinhas, totalPacotes, totalHistoricos, totalVinculos, totalClientes,
+        totalPacotesClientes, totalResumos, totalRotas;
+    const RegistroEvento* registros = static_cast<const RegistroEvento*>(
+        secoes.ler(SECAO_EVENTOS, sizeof(RegistroEvento), totalEventos));
+    verificarSnapshot(totalEventos <= INT32_MAX, "eventos demais");
+    int n = static_cast<int>(totalEventos);
+    const int32_t* linhas = lerIndices(secoes, SECAO_LINHAS, totalLinhas, n);
+    verificarSnapshot(totalLinhas == totalEventos, "linhas e eventos com tamanhos diferentes");
+    const RegistroPacote* regPacotes = static_cast<const RegistroPacote*>(
+        secoes.ler(SECAO_PACOTES, sizeof(RegistroPacote), totalPacotes));
+    const int32_t* historicos = lerIndices(secoes, SECAO_HISTORICOS, totalHistoricos, n);
+    const int32_t* vinculos = lerIndices(secoes, SECAO_VINCULOS, totalVinculos, totalNomes);
+    const RegistroCliente* regClientes = static_cast<const RegistroCliente*>(
+        secoes.ler(SECAO_CLIENTES, sizeof(RegistroCliente), totalClientes));
+    const int32_t* pacotesClientes = static_cast<const int32_t*>(
+        secoes.ler(SECAO_PACOTES_CLIENTES, sizeof(int32_t), totalPacotesClientes));
+    const RegistroResumo* resumos = static_cast<const RegistroResumo*>(
+        secoes.ler(SECAO_RESUMOS, sizeof(RegistroResumo), totalResumos));
+    const RegistroRota* regRotas = static_cast<const RegistroRota*>(
+        secoes.ler(SECAO_ROTAS, sizeof(RegistroRota), totalRotas));
+    verificarSnapshot(secoes.terminou(), "dados depois da ultima secao");
+
+    // Eventos: uma cópia em bloco para o pool, conferida em seguida
+    Evento* base = poolEventos.reservarContiguos(n);
+    if (n > 0) memcpy(static_cast<void*>(base), registros, sizeof(RegistroEvento) * n);
+    for (int i = 0; i < n; i++) {
+        const RegistroEvento& r = registros[i];
+        bool nomesValidos = r.tipo != RG ||
+            (r.remetente >= 0 && r.remetente < totalNomes && r.destinatario >= 0 && r.destinatario < totalNomes);
+        verificarSnapshot(r.sequencia == i && r.tipo >= RG && r.tipo <= EN && nomesValidos, "evento inconsistente");
+    }
+    if (modoEventos == EVENTOS_COLUNAR) {
+        eventosColunares.restaurar(n, linhas, base);
+    } else {
+        for (int i = 0; i < n; i++) eventos.inserir(base + linhas[i]);
+    }
+    // Em ordem de chave, cada armazém só recebe anexações
+    for (int i = 0; i < n; i++) eventosPorArmazem.inserir(base + linhas[i]);
+
+    // Clientes antes dos pacotes, que apontam para eles
+    for (uint64_t i = 0; i < totalClientes; i++) {
+        int idNome = regClientes[i].idNome;
+        verificarSnapshot(idNome >= 0 && idNome < totalNomes && !clientes.buscar(idNome), "cliente invalido");
+        createCliente(idNome);
+    }
+
+    VetorTemporario<Evento*> historico(totalHistoricos);
+    VetorTemporario<Cliente*> vinculados(totalVinculos);
+    for (uint64_t i = 0; i < totalHistoricos; i++) historico[i] = base + historicos[i];
+    for (uint64_t i = 0; i < totalVinculos; i++) vinculados[i] = clientes.buscar(vinculos[i]);
+    uint64_t h = 0, v = 0;
+    for (uint64_t i = 0; i < totalPacotes; i++) {
+        const RegistroPacote& r = regPacotes[i];
+        verificarSnapshot(!getPacote(r.id), "pacote repetido");
+        verificarSnapshot(r.primeiroEvento >= -1 && r.primeiroEvento < n && r.ultimoEvento >= -1 && r.ultimoEvento < n &&
+                          r.totalHistorico >= 0 && static_cast<uint64_t>(r.totalHistorico) <= totalHistoricos - h &&
+                          r.totalVinculados >= 0 && static_cast<uint64_t>(r.totalVinculados) <= totalVinculos - v, "pacote invalido");
+        for (int j = 0; j < r.totalVinculados; j++) {
+            verificarSnapshot(vinculados[v + j] != nullptr, "pacote vinculado a cliente inexistente");
+        }
+        createPacote(r.id)->restaurar(r.primeiroEvento < 0 ? nullptr : base + r.primeiroEvento,
+                                      r.ultimoEvento < 0 ? nullptr : base + r.ultimoEvento,
+                                      &historico[h], r.totalHistorico, &vinculados[v], r.totalVinculados);
+        h += r.totalHistorico;
+        v += r.totalVinculados;
+    }
+    verificarSnapshot(h == totalHistoricos && v == totalVinculos, "historicos ou vinculos sobrando");
+
+    uint64_t pc = 0, rs = 0;
+    for (uint64_t i = 0; i < totalClientes; i++) {
+        const RegistroCliente& r = regClientes[i];
+        Cliente* cliente = clientes.buscar(r.idNome);
+        verificarSnapshot(r.totalRemetente >= 0 && r.totalDestinatario >= 0 &&
+                          static_cast<uint64_t>(r.totalRemetente) + r.totalDestinatario <= totalPacotesClientes - pc &&
+                          r.totalResumo >= 0 && static_cast<uint64_t>(r.totalResumo) <= totalResumos - rs &&
+                          r.vivos >= 0 && r.vivos <= r.totalResumo, "cliente invalido");
+        for (int j = 0; j < r.totalRemetente; j++) cliente->adicionarPacoteRemetente(pacotesClientes[pc++]);
+        for (int j = 0; j < r.totalDestinatario; j++) cliente->adicionarPacoteDestinatario(pacotesClientes[pc++]);
+        ResumoCliente& resumo = cliente->getResumo();
+        resumo.restaurar(r.totalResumo, r.vivos);
+        for (int j = 0; j < r.totalResumo; j++, rs++) {
+            int evento = resumos[rs].evento;
+            verificarSnapshot(evento >= 0 && evento < n, "resumo com evento inexistente");
+            Pacote* pacote = getPacote(base[evento].idPacote);
+            verificarSnapshot(pacote != nullptr, "resumo com pacote inexistente");
+            resumo.anexar(base + evento, pacote, resumos[rs].sequencia);
+        }
+    }
+    verificarSnapshot(pc == totalPacotesClientes && rs == totalResumos, "pacotes ou resumos sobrando");
+
+    for (uint64_t i = 0; i < totalRotas; i++) {
+        rotasCongestionadas.restaurar(regRotas[i].origem, regRotas[i].destino, regRotas[i].contagem);
+    }
+    proximaSequencia = n;
+
+    bytesLidos += snapshot.getTamanho();
+    segundosCarga += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Aplica as linhas de um lote na ordem, avisando os erros com o número da
+// linha no arquivo (linhaBase = linhas dos lotes anteriores)
+void Simulador::aplicarLote(const LoteLinhas& lote, int linhaBase, DestinoResposta& destino) {
+    INSTRUMENTAR(if (instrumentacao) instrumentacao->juntar(ETAPA_INTERPRETAR, lote.getInterpretacao()));
+    int erro = 0;
+    for (int i = 0; i < lote.getTotalLinhas(); i++) {
+        for (; erro < lote.getTotalErros() && lote.getErro(erro).indice <= i; erro++) {
+            avisarErroLinha(linhaBase + lote.getErro(erro).numeroLinha, lote.getErro(erro).mensagem.c_str());
+        }
+        try {
+            processarLinha(lote.getLinha(i), destino);
+        } catch (const std::exception& e) {
+            avisarErroLinha(linhaBase + lote.getNumeroLinha(i), e.what());
         }
     }
+    for (; erro < lote.getTotalErros(); erro++) {
+        avisarErroLinha(linhaBase + lote.getErro(erro).numeroLinha, lote.getErro(erro).mensagem.c_str());
+    }
+}
+
+// Aplica uma linha já interpretada: eventos atualizam os índices, consultas são respondidas
+void Simulador::processarLinha(const LinhaEntrada& linha) {
+    processarLinha(linha, formatador);
+}
+
+void Simulador::processarLinha(const LinhaEntrada& linha, DestinoResposta& destino) {
+    if (linha.tipo == LINHA_EVENTO) {
+        if (linha.evento.tipo == RG) {
+            Evento evento = linha.evento;
+            evento.remetente = nomes.internar(linha.remetente.inicio, linha.remetente.tamanho);
+            evento.destinatario = nomes.internar(linha.destinatario.inicio, linha.destinatario.tamanho);
+            processarEvento(evento);
+        } else {
+            processarEvento(linha.evento);
+        }
+    } else if (linha.tipo == LINHA_CONSULTA) {
+        avaliarConsulta(linha.consulta, destino);
+    }
 }
 
 // Busca um pacote pelo ID. Retorna nullptr se não encontrado.
@@ -59,7 +548,7 @@ Pacote* Simulador::getPacote(int idPacote) const {
 
 // Cria um novo pacote, o insere na árvore e o retorna.
 Pacote* Simulador::createPacote(int idPacote) {
-    Pacote* pct = new Pacote(idPacote);
+    Pacote* pct = poolPacotes.criar(idPacote);
     pacotes.inserir(pct);
     return pct;
 }
@@ -67,218 +556,273 @@ Pacote* Simulador::createPacote(int idPacote) {
 // FUNÇÃO QUE ESTAVA FALTANDO
 // Busca um cliente pelo nome. Retorna nullptr se não encontrado.
 Cliente* Simulador::getCliente(const std::string& nome) const {
-    return clientes.buscar(nome);
+    return clientes.buscar(nomes.buscar(nome.data(), static_cast<int>(nome.size())));
 }
 
-// Cria um novo cliente, o insere na árvore e o retorna.
-Cliente* Simulador::createCliente(const std::string& nome) {
-    Cliente* cliente = new Cliente(nome);
+// Cria um novo cliente a partir do ID do nome, o insere na árvore e o retorna.
+Cliente* Simulador::createCliente(int idNome) {
+    Cliente* cliente = poolClientes.criar(nomes.getNome(idNome), idNome);
     clientes.inserir(cliente);
     return cliente;
 }
 
 void Simulador::processarEvento(const Evento &evento)
 {
+    INSTRUMENTAR(Cronometro cronometro(instrumentacao));
+    INSTRUMENTAR(if (instrumentacao) instrumentacao->contarEvento(evento.tipo));
     Pacote* pct = getPacote(evento.idPacote);
     if (!pct) {
         pct = createPacote(evento.idPacote); // Cria pacote se não existir
     }
-
-    Evento *novoEvento = new Evento(evento);
-    eventos.inserir(novoEvento);
+    INSTRUMENTAR(cronometro.marcar(ETAPA_EVENTO_PACOTE));
+
+    Evento *novoEvento = poolEventos.criar(evento);
+    novoEvento->sequencia = proximaSequencia++;
+    if (novoEvento->tipo == RG) {
+        // Evento montado sem nomes: usa o nome vazio, como antes
+        if (novoEvento->remetente < 0) novoEvento->remetente = nomes.internar(string());
+        if (novoEvento->destinatario < 0) novoEvento->destinatario = nomes.internar(string());
+    }
+    if (modoEventos == EVENTOS_COLUNAR) {
+        eventosColunares.inserir(novoEvento);
+    } else {
+        eventos.inserir(novoEvento);
+    }
+    eventosPorArmazem.inserir(novoEvento);
+    INSTRUMENTAR(cronometro.marcar(ETAPA_EVENTO_INDICE));
+    pct->adicionarEvento(novoEvento);
 
     if (pct->getPrimeiroEvento() == nullptr)
         pct->setPrimeiroEvento(novoEvento);
-    pct->setUltimoEvento(novoEvento);
+    pct->setUltimoEvento(novoEvento, versaoMinimaLeitura);
+    INSTRUMENTAR(cronometro.marcar(ETAPA_EVENTO_HISTORICO));
 
     if (evento.tipo == RG)
     {
         // Atualiza remetente
-        Cliente *remetente = getCliente(evento.remetente);
+        Cliente *remetente = clientes.buscar(novoEvento->remetente);
         if (!remetente) {
-            remetente = createCliente(evento.remetente);
+            remetente = createCliente(novoEvento->remetente);
         }
         remetente->adicionarPacoteRemetente(evento.idPacote);
+        pct->vincularCliente(remetente, versaoMinimaLeitura);
 
         // Atualiza destinatário
-        Cliente *destinatario = getCliente(evento.destinatario);
+        Cliente *destinatario = clientes.buscar(novoEvento->destinatario);
         if(!destinatario) {
-            destinatario = createCliente(evento.destinatario);
+            destinatario = createCliente(novoEvento->destinatario);
         }
         destinatario->adicionarPacoteDestinatario(evento.idPacote);
+        pct->vincularCliente(destinatario, versaoMinimaLeitura);
+        INSTRUMENTAR(cronometro.marcar(ETAPA_EVENTO_CLIENTES));
     }
     // Adicionado: Atualiza contagem de rotas para eventos de transporte
     else if (evento.tipo == TR)
     {
         rotasCongestionadas.incrementar(evento.armazemOrigem, evento.armazemDestino);
+        INSTRUMENTAR(cronometro.marcar(ETAPA_EVENTO_ROTAS));
     }
 }
 
-ListaEventos Simulador::getHistoricoPacote(int idPacote) const
-{
-    ListaEventos todosEventos = eventos.getTodosEventos();
-    ListaEventos resultado;
-
-    for (auto it = todosEventos.begin(); it.eValido(); ++it)
-        if ((*it).idPacote == idPacote)
-            resultado.push_back(*it);
-
-    return resultado;
+// Quantos eventos em [inicio, fim) do vetor existem na versão dada
+static int contarAteVersao(const VetorEventos& vetor, int inicio, int fim, long long versao) {
+    int total = 0;
+    for (int i = inicio; i < fim; i++)
+        if (vetor.get(i)->sequencia < versao) total++;
+    return total;
 }
 
-// Imprime um evento formatado
-void imprimirEvento(Evento *e)
+// Envia um evento ao destino, com os nomes do RG já resolvidos
+void Simulador::emitirEvento(DestinoResposta& destino, const Evento* e) const
 {
-    if (!e) return;
-    cout << setfill('0') << setw(7) << e->tempo << " EV ";
-    switch (e->tipo)
-    {
-        case RG: cout << "RG "; break;
-        case AR: cout << "AR "; break;
-        case RM: cout << "RM "; break;
-        case UR: cout << "UR "; break;
-        case TR: cout << "TR "; break;
-        case EN: cout << "EN "; break;
-    }
-    cout << setfill('0') << setw(3) << e->idPacote;
-
-    if (e->tipo == RG)
-        cout << " " << e->remetente << " " << e->destinatario
-             << " " << setfill('0') << setw(3) << e->armazemOrigem
-             << " " << setfill('0') << setw(3) << e->armazemDestino;
-    else if (e->tipo == AR)
-        cout << " " << setfill('0') << setw(3) << e->armazemOrigem
-             << " " << setfill('0') << setw(3) << e->secaoDestino; // Corrigido para seção destino
-    else if (e->tipo == RM || e->tipo == UR || e->tipo == TR)
-        cout << " " << setfill('0') << setw(3) << e->armazemOrigem
-             << " " << setfill('0') << setw(3) << e->armazemDestino;
-    else if (e->tipo == EN)
-        cout << " " << setfill('0') << setw(3) << e->armazemDestino;
-    
-    cout << endl;
+    ItemResposta item;
+    item.evento = e;
+    item.remetente = e->tipo == RG ? &nomes.getNome(e->remetente) : nullptr;
+    item.destinatario = e->tipo == RG ? &nomes.getNome(e->destinatario) : nullptr;
+    destino.adicionar(item);
 }
 
 // Novo método para consulta MA
-void Simulador::processarConsultaMovimentacaoArmazem(istringstream& iss, int timestamp) {
-    int tempoInicio, tempoFim, idArmazem;
-    if (!(iss >> tempoInicio >> tempoFim >> idArmazem)) {
-        throw std::runtime_error("Formato de consulta MA invalido.");
-    }
-
-    cout << " " << setfill('0') << setw(7) << tempoInicio 
-         << " " << setfill('0') << setw(7) << tempoFim
-         << " " << setfill('0') << setw(3) << idArmazem << endl;
-
-    ListaEventos eventosIntervalo = eventos.getEventosNoIntervalo(tempoInicio, tempoFim);
-    ListaEventos eventosFiltrados;
-
-    for(auto it = eventosIntervalo.begin(); it.eValido(); ++it) {
-        Evento& ev = *it;
-        if (ev.armazemOrigem == idArmazem || ev.armazemDestino == idArmazem) {
-             eventosFiltrados.push_back(ev);
-        }
+void Simulador::avaliarConsultaMovimentacaoArmazem(CabecalhoResposta& cabecalho, DestinoResposta& destino, long long versao) const {
+    const Consulta& consulta = cabecalho.consulta;
+    int tempoInicio = consulta.tempoInicio;
+    int tempoFim = consulta.tempoFim;
+    int idArmazem = consulta.idArmazem;
+    bool completa = versao >= proximaSequencia; // Nenhum evento a ignorar
+
+    // Lê apenas a fatia [tempoInicio, tempoFim] do armazém consultado
+    const VetorEventos* doArmazem = eventosPorArmazem.getEventos(idArmazem);
+    if (!doArmazem) {
+        destino.iniciar(cabecalho);
+        return;
     }
 
-    cout << eventosFiltrados.getTamanho() << endl;
-    for(auto it = eventosFiltrados.begin(); it.eValido(); ++it) {
-        imprimirEvento(&(*it));
+    int inicio = doArmazem->limiteInferior(tempoInicio);
+    int fim = doArmazem->limiteSuperior(tempoFim);
+    if (fim < inicio) fim = inicio;
+    // Mesma fatia do run lateral do armazém, intercalada pela chave
+    const VetorEventos* atrasados = eventosPorArmazem.getAtrasados(idArmazem);
+    int atrasado = atrasados->limiteInferior(tempoInicio);
+    int fimAtrasados = atrasados->limiteSuperior(tempoFim);
+    if (fimAtrasados < atrasado) fimAtrasados = atrasado;
+
+    cabecalho.total = completa ? (fim - inicio) + (fimAtrasados - atrasado)
+                               : contarAteVersao(*doArmazem, inicio, fim, versao) +
+                                 contarAteVersao(*atrasados, atrasado, fimAtrasados, versao);
+    destino.iniciar(cabecalho);
+    for (int i = inicio; i < fim || atrasado < fimAtrasados;) {
+        const Evento* ev;
+        if (atrasado == fimAtrasados ||
+            (i < fim && gerarChaveEvento(*doArmazem->get(i)) < gerarChaveEvento(*atrasados->get(atrasado))))
+            ev = doArmazem->get(i++);
+        else
+            ev = atrasados->get(atrasado++);
+        if (completa || ev->sequencia < versao) emitirEvento(destino, ev);
     }
 }
 
-// Novo método para consulta RC
-void Simulador::processarConsultaRotasCongestionadas(int timestamp) {
-    cout << endl; // Fim da linha da consulta
-    ListaRotas rotas = rotasCongestionadas.getRotasOrdenadas();
-    
-    cout << rotas.getTamanho() << endl;
+// Novo método para consulta RC; "RC k" retorna apenas as k rotas mais usadas
+void Simulador::avaliarConsultaRotasCongestionadas(CabecalhoResposta& cabecalho, DestinoResposta& destino) const {
+    ListaRotas rotas = rotasCongestionadas.getRotasOrdenadas(cabecalho.consulta.limite);
+
+    cabecalho.total = rotas.getTamanho();
+    destino.iniciar(cabecalho);
     for (auto it = rotas.begin(); it.eValido(); ++it) {
         Rota& rota = *it;
-        cout << setfill('0') << setw(3) << rota.origem 
-             << " " << setfill('0') << setw(3) << rota.destino 
-             << " " << rota.contagem << endl;
+        ItemResposta item;
+        item.evento = nullptr;
+        item.origem = rota.origem;
+        item.destino = rota.destino;
+        item.contagem = rota.contagem;
+        destino.adicionar(item);
     }
 }
 
 
+// Versão que recebe o texto da linha; interpreta e delega para a versão abaixo
 void Simulador::processarConsulta(const string &linha)
 {
-    istringstream iss(linha);
-    int timestamp;
-    string tipo;
-
-    if (!(iss >> timestamp >> tipo)) {
+    LinhaEntrada interpretada;
+    LeitorEntrada::interpretar(Fatia(linha.data(), static_cast<int>(linha.size())), interpretada);
+    if (interpretada.tipo != LINHA_CONSULTA) {
         throw std::runtime_error("Formato de consulta invalido: " + linha);
     }
+    processarConsulta(interpretada.consulta);
+}
 
-    cout << setfill('0') << setw(7) << timestamp << " " << tipo;
+void Simulador::processarConsulta(const Consulta &consulta)
+{
+    avaliarConsulta(consulta, formatador);
+}
 
-    if (tipo == "PC")
-    {
-        int idPacote;
-        if (!(iss >> idPacote)) {
-            throw std::runtime_error("ID do pacote ausente na consulta PC: " + linha);
-        }
-        cout << " " << setfill('0') << setw(3) << idPacote << endl;
+void Simulador::avaliarConsulta(const Consulta &consulta, DestinoResposta &destino)
+{
+    prepararLeitura();
+    avaliarConsultaNaVersao(consulta, destino, VERSAO_ATUAL, instrumentacao);
+}
 
-        ListaEventos historico = getHistoricoPacote(idPacote);
-        cout << historico.getTamanho() << endl;
+void Simulador::prepararLeitura()
+{
+    if (modoEventos == EVENTOS_COLUNAR) eventosColunares.prepararLeitura();
+}
 
-        for (auto it = historico.begin(); it.eValido(); ++it)
-            imprimirEvento(&(*it));
-    }
-    else if (tipo == "CL")
+void Simulador::avaliarConsultaNaVersao(const Consulta &consulta, DestinoResposta &destino, long long versao,
+                                        Instrumentacao *medidas) const
+{
+    // A medida inclui a entrega ao destino; consultas malformadas, que
+    // lançam exceção em responderNaVersao, só são contadas
+    INSTRUMENTAR(Cronometro cronometro(medidas));
+    INSTRUMENTAR(if (medidas && !consulta.camposCompletos) medidas->contarConsultaInvalida());
+    responderNaVersao(consulta, destino, versao);
+    INSTRUMENTAR(cronometro.marcar(static_cast<EtapaMedida>(ETAPA_CONSULTA_PC + consulta.tipo)));
+}
+
+void Simulador::responderNaVersao(const Consulta &consulta, DestinoResposta &destino, long long versao) const
+{
+    bool completa = versao >= proximaSequencia; // Nenhum evento a ignorar
+    CabecalhoResposta cabecalho;
+    cabecalho.consulta = consulta;
+    cabecalho.valida = consulta.camposCompletos;
+    cabecalho.total = 0;
+
+    if (!consulta.camposCompletos)
     {
-        string nomeCliente;
-        if (!(iss >> nomeCliente)) {
-             throw std::runtime_error("Nome do cliente ausente na consulta CL: " + linha);
+        // O destino ainda recebe o cabeçalho, que sai só com tempo e tipo
+        destino.iniciar(cabecalho);
+        switch (consulta.tipo)
+        {
+        case CONSULTA_PC:
+            throw std::runtime_error("ID do pacote ausente na consulta PC: " + consulta.linha.str());
+        case CONSULTA_CL:
+            throw std::runtime_error("Nome do cliente ausente na consulta CL: " + consulta.linha.str());
+        case CONSULTA_MA:
+            throw std::runtime_error("Formato de consulta MA invalido.");
+        case CONSULTA_RC:
+            throw std::runtime_error("Limite invalido na consulta RC.");
         }
-        cout << " " << nomeCliente << endl;
+    }
 
-        Cliente *cliente = clientes.buscar(nomeCliente);
-        if (!cliente)
+    if (consulta.tipo == CONSULTA_PC)
+    {
+        // Percorre direto o histórico do pacote, sem copiar eventos
+        Pacote *pct = getPacote(consulta.idPacote);
+        if (!pct)
         {
-            cout << 0 << endl;
+            destino.iniciar(cabecalho);
             return;
         }
 
-        ArvoreEventos eventosRelevantes;
-        // Adiciona eventos dos pacotes em que o cliente é remetente
-        for (auto it = cliente->getPacotesRemetente().begin(); it.eValido(); ++it)
+        const VetorEventos &historico = pct->getHistorico();
+        cabecalho.total = completa ? historico.getTamanho() : contarAteVersao(historico, 0, historico.getTamanho(), versao);
+        destino.iniciar(cabecalho);
+        for (int i = 0; i < historico.getTamanho(); i++)
+            if (completa || historico.get(i)->sequencia < versao)
+                emitirEvento(destino, historico.get(i));
+    }
+    else if (consulta.tipo == CONSULTA_CL)
+    {
+        Cliente *cliente = clientes.buscar(nomes.buscar(consulta.nomeCliente.inicio, consulta.nomeCliente.tamanho));
+        if (!cliente)
         {
-            Pacote *pct = pacotes.buscar(*it);
-            if (pct) {
-                if (pct->getPrimeiroEvento()) eventosRelevantes.inserir(pct->getPrimeiroEvento());
-                if (pct->getUltimoEvento() && pct->getUltimoEvento() != pct->getPrimeiroEvento()) eventosRelevantes.inserir(pct->getUltimoEvento());
-            }
+            destino.iniciar(cabecalho);
+            return;
         }
-        // Adiciona eventos dos pacotes em que o cliente é destinatário
-        for (auto it = cliente->getPacotesDestinatario().begin(); it.eValido(); ++it)
+
+        // O resumo já está em ordem; basta pular as entradas obsoletas
+        const ResumoCliente &resumo = cliente->getResumo();
+        if (completa)
         {
-            Pacote *pct = pacotes.buscar(*it);
-            if (pct) {
-                if (pct->getPrimeiroEvento()) eventosRelevantes.inserir(pct->getPrimeiroEvento());
-                if (pct->getUltimoEvento() && pct->getUltimoEvento() != pct->getPrimeiroEvento()) eventosRelevantes.inserir(pct->getUltimoEvento());
-            }
+            cabecalho.total = resumo.getVivos();
+            destino.iniciar(cabecalho);
+            for (int i = 0; i < resumo.getTamanho(); i++)
+                if (resumo.valida(i))
+                    emitirEvento(destino, resumo.getEvento(i));
+            return;
         }
 
-        cout << eventosRelevantes.tamanho() << endl;
-        eventosRelevantes.emOrdem(imprimirEvento);
+        for (int i = 0; i < resumo.getTamanho(); i++)
+            if (resumo.validaNaVersao(i, versao))
+                cabecalho.total++;
+        destino.iniciar(cabecalho);
+        for (int i = 0; i < resumo.getTamanho(); i++)
+            if (resumo.validaNaVersao(i, versao))
+                emitirEvento(destino, resumo.getEvento(i));
     }
     // Adicionado: Lidar com novas consultas
-    else if (tipo == "MA")
+    else if (consulta.tipo == CONSULTA_MA)
     {
-        processarConsultaMovimentacaoArmazem(iss, timestamp);
+        avaliarConsultaMovimentacaoArmazem(cabecalho, destino, versao);
     }
-    else if (tipo == "RC")
+    else if (consulta.tipo == CONSULTA_RC)
     {
-        processarConsultaRotasCongestionadas(timestamp);
+        avaliarConsultaRotasCongestionadas(cabecalho, destino);
     }
 }
 
 ListaPacotes Simulador::getPacotesCliente(const string &nomeCliente) const
 {
     ListaPacotes resultado;
-    Cliente *cliente = clientes.buscar(nomeCliente);
+    Cliente *cliente = getCliente(nomeCliente);
 
     if (cliente)
     {
@@ -300,4 +844,48 @@ ListaPacotes Simulador::getPacotesCliente(const string &nomeCliente) const
         }
     }
     return resultado;
-}
\ No newline at end of file
+}
+
+size_t Simulador::getBytesLidos() const
+{
+    return bytesLidos;
+}
+
+double Simulador::getSegundosCarga() const
+{
+    return segundosCarga;
+}
+
+TabelaNomes& Simulador::getNomes()
+{
+    return nomes;
+}
+
+const TabelaNomes& Simulador::getNomes() const
+{
+    return nomes;
+}
+
+void Simulador::descarregarSaida()
+{
+    saida.descarregar();
+}
+
+Instrumentacao* Simulador::getInstrumentacao() const
+{
+    return instrumentacao;
+}
+
+void Simulador::ligarInstrumentacao(Instrumentacao* instrumentacao)
+{
+    this->instrumentacao = instrumentacao;
+}
+
+void Simulador::imprimirEstatisticas(std::ostream& saida) const
+{
+    if (instrumentacao) instrumentacao->imprimir(saida);
+    saida << "  pools: " << poolEventos.getTotalObjetos() << " eventos em " << poolEventos.getTotalBlocos()
+          << " blocos, " << poolPacotes.getTotalObjetos() << " pacotes em " << poolPacotes.getTotalBlocos()
+          << " blocos, " << poolClientes.getTotalObjetos() << " clientes em " << poolClientes.getTotalBlocos()
+          << " blocos" << endl;
+}
@@ -0,0 +1,68 @@
+#include "Snapshot.h"
+#include <stdexcept>
+
+using namespace std;
+
+const char MAGICA_SNAPSHOT[8] = {'T', 'P', '3', 'S', 'N', 'A', 'P', '\0'};
+
+static_assert(sizeof(RegistroEvento) == 40, "layout do registro de evento mudou");
+static_assert(sizeof(CabecalhoSecao) == 16, "layout do cabecalho de secao mudou");
+
+RegistroEvento paraRegistro(const Evento& ev) {
+    RegistroEvento r;
+    r.sequencia = ev.sequencia;
+    r.tempo = ev.tempo;
+    r.idPacote = ev.idPacote;
+    r.armazemOrigem = ev.armazemOrigem;
+    r.armazemDestino = ev.armazemDestino;
+    r.secaoDestino = ev.secaoDestino;
+    r.remetente = ev.remetente;
+    r.destinatario = ev.destinatario;
+    r.tipo = ev.tipo;
+    return r;
+}
+
+static size_t preenchimento(uint64_t bytes) {
+    return static_cast<size_t>((8 - bytes % 8) % 8);
+}
+
+void gravarSecao(GravadorBinario& gravador, SecaoSnapshot secao, const void* dados,
+                 size_t tamanhoElemento, uint64_t total) {
+    static const char ZEROS[8] = {0};
+    CabecalhoSecao cabecalho;
+    cabecalho.secao = secao;
+    cabecalho.tamanhoElemento = static_cast<uint32_t>(tamanhoElemento);
+    cabecalho.total = total;
+    gravador.escreverRegistro(&cabecalho, sizeof(cabecalho));
+    uint64_t bytes = total * tamanhoElemento;
+    if (bytes > 0) gravador.escreverRegistro(dados, bytes);
+    gravador.escreverRegistro(ZEROS, preenchimento(bytes));
+}
+
+LeitorSecoes::LeitorSecoes(const LeitorBinario& snapshot)
+    : atual(snapshot.getInicioRegistros()), fim(snapshot.getFimRegistros()) {}
+
+const void* LeitorSecoes::ler(SecaoSnapshot secao, size_t tamanhoElemento, uint64_t& total) {
+    uint64_t restantes = static_cast<uint64_t>(fim - atual);
+    if (restantes < sizeof(CabecalhoSecao)) {
+        throw runtime_error("Snapshot invalido: faltam secoes");
+    }
+    const CabecalhoSecao* cabecalho = reinterpret_cast<const CabecalhoSecao*>(atual);
+    if (cabecalho->secao != static_cast<uint32_t>(secao) || cabecalho->tamanhoElemento != tamanhoElemento) {
+        throw runtime_error("Snapshot invalido: secao " + to_string(cabecalho->secao) +
+                            " no lugar da secao " + to_string(secao));
+    }
+    restantes -= sizeof(CabecalhoSecao);
+    if (cabecalho->total > restantes / tamanhoElemento) {
+        throw runtime_error("Snapshot invalido: secao " + to_string(secao) + " passa do fim do arquivo");
+    }
+    uint64_t bytes = cabecalho->total * tamanhoElemento;
+    bytes += preenchimento(bytes);
+    if (bytes > restantes) {
+        throw runtime_error("Snapshot invalido: secao " + to_string(secao) + " passa do fim do arquivo");
+    }
+    total = cabecalho->total;
+    const void* dados = atual + sizeof(CabecalhoSecao);
+    atual += sizeof(CabecalhoSecao) + bytes;
+    return dados;
+}
@@ -0,0 +1,98 @@
+#include "TabelaNomes.h"
+#include <cstring>
+
+TabelaNomes::TabelaNomes()
+    : entradas(nullptr), totalNomes(0), capacidadeEntradas(0), slots(nullptr), capacidadeSlots(0) {}
+
+TabelaNomes::~TabelaNomes() {
+    delete[] entradas;
+    delete[] slots;
+}
+
+// FNV-1a de 32 bits
+unsigned int TabelaNomes::calcularHash(const char* texto, int tamanho) {
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < tamanho; i++) {
+        hash ^= static_cast<unsigned char>(texto[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Retorna o slot que contém o nome, ou o slot vazio onde ele deveria ficar
+int TabelaNomes::procurarSlot(const char* texto, int tamanho, unsigned int hash) const {
+    int mascara = capacidadeSlots - 1;
+    int slot = static_cast<int>(hash & mascara);
+    while (slots[slot] != -1) {
+        const Entrada& entrada = entradas[slots[slot]];
+        if (entrada.hash == hash && static_cast<int>(entrada.nome->size()) == tamanho &&
+            memcmp(entrada.nome->data(), texto, tamanho) == 0) {
+            return slot;
+        }
+        slot = (slot + 1) & mascara;
+    }
+    return slot;
+}
+
+// Dobra a tabela hash e reinsere os IDs usando os hashes guardados
+void TabelaNomes::redimensionar() {
+    int novaCapacidade = capacidadeSlots ? capacidadeSlots * 2 : 64;
+    int* novosSlots = new int[novaCapacidade];
+    for (int i = 0; i < novaCapacidade; i++) novosSlots[i] = -1;
+
+    int mascara = novaCapacidade - 1;
+    for (int id = 0; id < totalNomes; id++) {
+        int slot = static_cast<int>(entradas[id].hash & mascara);
+        while (novosSlots[slot] != -1) slot = (slot + 1) & mascara;
+        novosSlots[slot] = id;
+    }
+
+    delete[] slots;
+    slots = novosSlots;
+    capacidadeSlots = novaCapacidade;
+}
+
+int TabelaNomes::internar(const char* texto, int tamanho) {
+    // Mantém a ocupação abaixo de 50%
+    if (2 * (totalNomes + 1) > capacidadeSlots) {
+        redimensionar();
+    }
+
+    unsigned int hash = calcularHash(texto, tamanho);
+    int slot = procurarSlot(texto, tamanho, hash);
+    if (slots[slot] != -1) {
+        return slots[slot];
+    }
+
+    if (totalNomes == capacidadeEntradas) {
+        int novaCapacidade = capacidadeEntradas ? capacidadeEntradas * 2 : 64;
+        Entrada* novas = new Entrada[novaCapacidade];
+        for (int i = 0; i < totalNomes; i++) novas[i] = entradas[i];
+        delete[] entradas;
+        entradas = novas;
+        capacidadeEntradas = novaCapacidade;
+    }
+
+    int id = totalNomes++;
+    entradas[id].nome = textos.criar(texto, tamanho);
+    entradas[id].hash = hash;
+    slots[slot] = id;
+    return id;
+}
+
+int TabelaNomes::internar(const std::string& nome) {
+    return internar(nome.data(), static_cast<int>(nome.size()));
+}
+
+int TabelaNomes::buscar(const char* texto, int tamanho) const {
+    if (totalNomes == 0) return -1;
+    return slots[procurarSlot(texto, tamanho, calcularHash(texto, tamanho))];
+}
+
+const std::string& TabelaNomes::getNome(int id) const {
+    return *entradas[id].nome;
+}
+
+int TabelaNomes::tamanho() const {
+    return totalNomes;
+}
@@ -0,0 +1,223 @@
+#include "TabelaPacotes.h"
+#include <algorithm>
+
+TabelaPacotes::TabelaPacotes()
+    : modo(MODO_DENSO), contador(0), menorId(0), maiorId(-1),
+      vetor(nullptr), capacidadeVetor(0), slots(nullptr), capacidadeHash(0) {}
+
+TabelaPacotes::~TabelaPacotes() {
+    delete[] vetor;
+    delete[] slots;
+}
+
+// Mistura os bits do id para que ids em sequência não formem aglomerados
+static unsigned int hashId(int chave) {
+    unsigned int h = static_cast<unsigned int>(chave);
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h;
+}
+
+bool TabelaPacotes::cabeNoVetor(int menor, int maior, int total) const {
+    if (menor < 0) return false;
+    return static_cast<long long>(maior) < static_cast<long long>(total) * FATOR_DENSIDADE + FOLGA_DENSA;
+}
+
+// Garante que vetor[id] exista, dobrando a capacidade
+void TabelaPacotes::crescerVetor(int id) {
+    long long novaCapacidade = capacidadeVetor ? capacidadeVetor : 64;
+    while (novaCapacidade <= id) novaCapacidade *= 2;
+
+    Pacote** novo = new Pacote*[novaCapacidade];
+    for (int i = 0; i < capacidadeVetor; i++) novo[i] = vetor[i];
+    for (long long i = capacidadeVetor; i < novaCapacidade; i++) novo[i] = nullptr;
+
+    delete[] vetor;
+    vetor = novo;
+    capacidadeVetor = static_cast<int>(novaCapacidade);
+}
+
+// Move os pacotes do vetor para a hash
+void TabelaPacotes::paraHash() {
+    capacidadeHash = 64;
+    while (capacidadeHash < 2 * (contador + 1)) capacidadeHash *= 2;
+    slots = new Slot[capacidadeHash];
+    for (int i = 0; i < capacidadeHash; i++) slots[i].pacote = nullptr;
+
+    modo = MODO_HASH;
+    for (int i = 0; i < capacidadeVetor; i++) {
+        if (vetor[i]) inserirHash(vetor[i]);
+    }
+    delete[] vetor;
+    vetor = nullptr;
+    capacidadeVetor = 0;
+}
+
+// Move os pacotes da hash de volta para o vetor
+void TabelaPacotes::paraDenso() {
+    crescerVetor(maiorId);
+    for (int i = 0; i < capacidadeHash; i++) {
+        if (slots[i].pacote) vetor[slots[i].chave] = slots[i].pacote;
+    }
+    delete[] slots;
+    slots = nullptr;
+    capacidadeHash = 0;
+    modo = MODO_DENSO;
+}
+
+void TabelaPacotes::redimensionarHash() {
+    Slot* antigos = slots;
+    int capacidadeAntiga = capacidadeHash;
+
+    capacidadeHash *= 2;
+    slots = new Slot[capacidadeHash];
+    for (int i = 0; i < capacidadeHash; i++) slots[i].pacote = nullptr;
+
+    int mascara = capacidadeHash - 1;
+    for (int i = 0; i < capacidadeAntiga; i++) {
+        if (!antigos[i].pacote) continue;
+        int slot = static_cast<int>(hashId(antigos[i].chave) & mascara);
+        while (slots[slot].pacote) slot = (slot + 1) & mascara;
+        slots[slot] = antigos[i];
+    }
+    delete[] antigos;
+}
+
+// Retorna o slot da chave, ou o slot vazio onde ela ficaria
+int TabelaPacotes::procurarSlot(int chave) const {
+    int mascara = capacidadeHash - 1;
+    int slot = static_cast<int>(hashId(chave) & mascara);
+    while (slots[slot].pacote && slots[slot].chave != chave) {
+        slot = (slot + 1) & mascara;
+    }
+    return slot;
+}
+
+// Insere sem verificar a carga; quem chama garante que há espaço
+void TabelaPacotes::inserirHash(Pacote* pacote) {
+    int slot = procurarSlot(pacote->getId());
+    slots[slot].chave = pacote->getId();
+    slots[slot].pacote = pacote;
+}
+
+// Remove com deslocamento para trás, sem deixar marcas de removido
+void TabelaPacotes::removerHash(int chave) {
+    int vazio = procurarSlot(chave);
+    if (!slots[vazio].pacote) return;
+
+    int mascara = capacidadeHash - 1;
+    slots[vazio].pacote = nullptr;
+    contador--;
+
+    int atual = (vazio + 1) & mascara;
+    while (slots[atual].pacote) {
+        int ideal = static_cast<int>(hashId(slots[atual].chave) & mascara);
+        bool mover = (vazio <= atual) ? (ideal <= vazio || ideal > atual)
+                                      : (ideal <= vazio && ideal > atual);
+        if (mover) {
+            slots[vazio] = slots[atual];
+            slots[atual].pacote = nullptr;
+            vazio = atual;
+        }
+        atual = (atual + 1) & mascara;
+    }
+}
+
+// Insere o pacote; se já existir um com o mesmo id, ele é substituído
+void TabelaPacotes::inserir(Pacote* pacote) {
+    int id = pacote->getId();
+    if (buscar(id)) {
+        // Substituição não muda o conjunto de ids
+        if (modo == MODO_DENSO) vetor[id] = pacote;
+        else slots[procurarSlot(id)].pacote = pacote;
+        return;
+    }
+
+    int novoMenor = contador ? std::min(menorId, id) : id;
+    int novoMaior = contador ? std::max(maiorId, id) : id;
+
+    if (modo == MODO_DENSO) {
+        if (id >= capacidadeVetor) {
+            if (cabeNoVetor(novoMenor, novoMaior, contador + 1)) {
+                crescerVetor(id);
+            } else {
+                paraHash();
+            }
+        } else if (id < 0) {
+            paraHash();
+        }
+    } else if (2 * (contador + 1) > capacidadeHash) {
+        if (cabeNoVetor(novoMenor, novoMaior, contador + 1)) {
+            menorId = novoMenor;
+            maiorId = novoMaior;
+            paraDenso();
+        } else {
+            redimensionarHash();
+        }
+    }
+
+    menorId = novoMenor;
+    maiorId = novoMaior;
+    contador++;
+
+    if (modo == MODO_DENSO) {
+        vetor[id] = pacote;
+    } else {
+        inserirHash(pacote);
+    }
+}
+
+void TabelaPacotes::remover(int chave) {
+    if (modo == MODO_DENSO) {
+        if (chave >= 0 && chave < capacidadeVetor && vetor[chave]) {
+            vetor[chave] = nullptr;
+            contador--;
+        }
+    } else if (contador > 0) {
+        removerHash(chave);
+    }
+}
+
+Pacote* TabelaPacotes::buscar(int chave) const {
+    if (modo == MODO_DENSO) {
+        if (static_cast<unsigned int>(chave) < static_cast<unsigned int>(capacidadeVetor)) {
+            return vetor[chave];
+        }
+        return nullptr;
+    }
+    return slots[procurarSlot(chave)].pacote;
+}
+
+static bool idMenor(const Pacote* a, const Pacote* b) {
+    return a->getId() < b->getId();
+}
+
+// Visita os pacotes em ordem de id
+void TabelaPacotes::emOrdem(void (*visitar)(Pacote*)) const {
+    if (modo == MODO_DENSO) {
+        for (int i = 0; i < capacidadeVetor; i++) {
+            if (vetor[i]) visitar(vetor[i]);
+        }
+        return;
+    }
+
+    Pacote** ordenados = new Pacote*[contador > 0 ? contador : 1];
+    int total = 0;
+    for (int i = 0; i < capacidadeHash; i++) {
+        if (slots[i].pacote) ordenados[total++] = slots[i].pacote;
+    }
+    std::sort(ordenados, ordenados + total, idMenor);
+    for (int i = 0; i < total; i++) {
+        visitar(ordenados[i]);
+    }
+    delete[] ordenados;
+}
+
+int TabelaPacotes::tamanho() const {
+    return contador;
+}
+
+TabelaPacotes::Modo TabelaPacotes::getModo() const {
+    return modo;
+}
@@ -0,0 +1,108 @@
+#include "VetorEventos.h"
+
+VetorEventos::VetorEventos() : dados(nullptr), tamanho(0), capacidade(0) {}
+
+VetorEventos::~VetorEventos() {
+    delete[] dados;
+}
+
+// Dobra a capacidade do vetor, copiando os ponteiros existentes
+void VetorEventos::crescer() {
+    int novaCapacidade = capacidade ? capacidade * 2 : 4;
+    Evento** novosDados = new Evento*[novaCapacidade];
+    for (int i = 0; i < tamanho; i++) {
+        novosDados[i] = dados[i];
+    }
+    delete[] dados;
+    dados = novosDados;
+    capacidade = novaCapacidade;
+}
+
+void VetorEventos::atribuir(Evento* const* eventos, int total) {
+    if (total > capacidade) {
+        delete[] dados;
+        dados = new Evento*[total];
+        capacidade = total;
+    }
+    for (int i = 0; i < total; i++) {
+        dados[i] = eventos[i];
+    }
+    tamanho = total;
+}
+
+void VetorEventos::mesclar(VetorEventos& outro) {
+    if (outro.tamanho == 0) return;
+    while (tamanho + outro.tamanho > capacidade) {
+        crescer();
+    }
+    int atual = tamanho - 1;
+    int vindo = outro.tamanho - 1;
+    int destino = tamanho + outro.tamanho - 1;
+    while (vindo >= 0) {
+        if (atual >= 0 && gerarChaveEvento(*dados[atual]) > gerarChaveEvento(*outro.dados[vindo])) {
+            dados[destino--] = dados[atual--];
+        } else {
+            dados[destino--] = outro.dados[vindo--];
+        }
+    }
+    tamanho += outro.tamanho;
+    outro.tamanho = 0;
+}
+
+bool VetorEventos::aceitaNoFim(const Evento* ev) const {
+    return tamanho == 0 || gerarChaveEvento(*dados[tamanho - 1]) < gerarChaveEvento(*ev);
+}
+
+// Insere o evento na posição correta, deslocando a partir do fim
+bool VetorEventos::inserirOrdenado(Evento* ev) {
+    ChaveEvento chave = gerarChaveEvento(*ev);
+    int pos = tamanho;
+    while (pos > 0 && gerarChaveEvento(*dados[pos - 1]) > chave) {
+        pos--;
+    }
+    if (pos > 0 && gerarChaveEvento(*dados[pos - 1]) == chave) {
+        return false; // Mesmo evento inserido duas vezes
+    }
+
+    if (tamanho == capacidade) {
+        crescer();
+    }
+    for (int i = tamanho; i > pos; i--) {
+        dados[i] = dados[i - 1];
+    }
+    dados[pos] = ev;
+    tamanho++;
+    return true;
+}
+
+Evento* VetorEventos::get(int indice) const {
+    return dados[indice];
+}
+
+int VetorEventos::limiteInferior(int tempo) const {
+    int ini = 0, fim = tamanho;
+    while (ini < fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (dados[meio]->tempo < tempo) ini = meio + 1;
+        else fim = meio;
+    }
+    return ini;
+}
+
+int VetorEventos::limiteSuperior(int tempo) const {
+    int ini = 0, fim = tamanho;
+    while (ini < fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (dados[meio]->tempo <= tempo) ini = meio + 1;
+        else fim = meio;
+    }
+    return ini;
+}
+
+int VetorEventos::getTamanho() const {
+    return tamanho;
+}
+
+bool VetorEventos::estaVazio() const {
+    return tamanho == 0;
+}
@@ -0,0 +1,259 @@
+// Teste do log binário (LogBinario): a conversão precisa ser sem perdas, para
+// qualquer valor que o texto aceita, e bem menor que a entrada texto.
+//
+// Uso: TesteLogBinario.out (sai com 1 se alguma verificação falhar)
+// 1. Round-trip: cada registro decodificado do log é igual, campo a campo, à
+//    LinhaEntrada que o texto dá para a mesma linha, inclusive com valores
+//    fora de 16 bits, negativos, nomes longos e consultas incompletas.
+// 2. Tamanho e saída: numa carga no formato do genwkl3, o log tem no máximo
+//    1/RAZAO_MINIMA do tamanho do texto, e o Simulador responde igual aos dois.
+#include "LeitorEntrada.h"
+#include "LogBinario.h"
+#include "Simulador.h"
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+static const double RAZAO_MINIMA = 3.0;
+static const int PACOTES = 20000;
+static const int ARMAZENS = 40;
+
+static int falhas = 0;
+
+#define VERIFICAR(condicao, contexto)                                                      \
+    do {                                                                                   \
+        if (!(condicao)) {                                                                 \
+            fprintf(stderr, "FALHOU: %s (%s:%d) em %s\n", #condicao, __FILE__, __LINE__,   \
+                    string(contexto).c_str());                                             \
+            falhas++;                                                                      \
+        }                                                                                  \
+    } while (0)
+
+static string arquivoTemporario(const char* sufixo) {
+    char modelo[] = "/tmp/tp3testeXXXXXX";
+    int fd = mkstemp(modelo);
+    if (fd < 0) {
+        perror("mkstemp");
+        exit(1);
+    }
+    close(fd);
+    unlink(modelo);
+    return string(modelo) + sufixo;
+}
+
+static void gravarArquivo(const string& nome, const string& conteudo) {
+    FILE* f = fopen(nome.c_str(), "w");
+    if (!f || fwrite(conteudo.data(), 1, conteudo.size(), f) != conteudo.size()) {
+        perror(nome.c_str());
+        exit(1);
+    }
+    fclose(f);
+}
+
+static string lerArquivo(const string& nome) {
+    string conteudo;
+    FILE* f = fopen(nome.c_str(), "r");
+    if (!f) return conteudo;
+    char buffer[65536];
+    size_t lidos;
+    while ((lidos = fread(buffer, 1, sizeof(buffer), f)) > 0) conteudo.append(buffer, lidos);
+    fclose(f);
+    return conteudo;
+}
+
+static bool mesmaFatia(const Fatia& a, const Fatia& b) {
+    return a.tamanho == b.tamanho && (a.tamanho == 0 || memcmp(a.inicio, b.inicio, a.tamanho) == 0);
+}
+
+// Compara o que importa de cada tipo de linha (o texto original das
+// consultas, consulta.linha, não vai para o log)
+static void compararLinhas(const LinhaEntrada& texto, const LinhaEntrada& log, const string& contexto) {
+    VERIFICAR(texto.tipo == log.tipo, contexto);
+    if (texto.tipo != log.tipo) return;
+    if (texto.tipo == LINHA_EVENTO) {
+        const Evento& a = texto.evento;
+        const Evento& b = log.evento;
+        VERIFICAR(a.tempo == b.tempo && a.tipo == b.tipo && a.idPacote == b.idPacote, contexto);
+        VERIFICAR(a.armazemOrigem == b.armazemOrigem && a.armazemDestino == b.armazemDestino &&
+                  a.secaoDestino == b.secaoDestino, contexto);
+        if (a.tipo == RG) {
+            VERIFICAR(mesmaFatia(texto.remetente, log.remetente), contexto);
+            VERIFICAR(mesmaFatia(texto.destinatario, log.destinatario), contexto);
+        }
+        return;
+    }
+    const Consulta& a = texto.consulta;
+    const Consulta& b = log.consulta;
+    VERIFICAR(a.tempo == b.tempo && a.tipo == b.tipo && a.camposCompletos == b.camposCompletos, contexto);
+    if (!a.camposCompletos) return;
+    switch (a.tipo) {
+        case CONSULTA_PC: VERIFICAR(a.idPacote == b.idPacote, contexto); break;
+        case CONSULTA_CL: VERIFICAR(mesmaFatia(a.nomeCliente, b.nomeCliente), contexto); break;
+        case CONSULTA_MA:
+            VERIFICAR(a.tempoInicio == b.tempoInicio && a.tempoFim == b.tempoFim && a.idArmazem == b.idArmazem,
+                      contexto);
+            break;
+        case CONSULTA_RC: VERIFICAR(a.limite == b.limite, contexto); break;
+    }
+}
+
+// Converte o texto e confere registro a registro contra a interpretação do
+// próprio texto. Todas as linhas precisam ser aceitas pelo texto.
+static ResumoConversao testarRoundTrip(const string& texto, const char* nomeCaso) {
+    string entrada = arquivoTemporario(".in");
+    string saida = arquivoTemporario(".bin");
+    gravarArquivo(entrada, texto);
+    ResumoConversao resumo = converterParaLogBinario(entrada, saida);
+    VERIFICAR(resumo.descartadas == 0, nomeCaso);
+
+    LeitorBinario log(saida, MAGICA_LOG, VERSAO_LOG, REGISTRO_VARIAVEL, "Log binario");
+    CursorLog cursor(log);
+    LeitorEntrada leitor(texto.data(), texto.data() + texto.size());
+    Fatia linhaTexto;
+    LinhaEntrada esperada, obtida;
+    RegistroLog registro;
+    long long registros = 0;
+    while (leitor.proximaLinha(linhaTexto)) {
+        string contexto = string(nomeCaso) + ", linha \"" + linhaTexto.str() + "\"";
+        LeitorEntrada::interpretar(linhaTexto, esperada);
+        bool temRegistro = cursor.proximo(registro);
+        VERIFICAR(temRegistro, contexto);
+        if (!temRegistro) break;
+        decodificarRegistroLog(registro, log, obtida);
+        compararLinhas(esperada, obtida, contexto);
+        registros++;
+    }
+    VERIFICAR(!cursor.proximo(registro), nomeCaso);
+    VERIFICAR(registros == resumo.registros && registros == log.getTotalRegistros(), nomeCaso);
+
+    unlink(entrada.c_str());
+    unlink(saida.c_str());
+    return resumo;
+}
+
+// Valores nos limites do int, que não cabiam no registro antigo de 24
+// bytes (armazém e seção em 16 bits), tempos fora de ordem e consultas
+// com campos faltando
+static string gerarCasosLimite() {
+    string nomeLongo(300, 'x');
+    char texto[1024];
+    string linhas;
+    const int valores[] = {0, 1, -1, 32767, 32768, -32768, -32769, 65535, 70000, 1 << 28, INT_MAX, INT_MIN};
+    const int total = sizeof(valores) / sizeof(valores[0]);
+    for (int i = 0; i < total; i++) {
+        int v = valores[i];
+        int w = valores[(i + 5) % total];
+        snprintf(texto, sizeof(texto), "%d EV RG %d %s cliente%d %d %d\n", v, w, nomeLongo.c_str(), i, v, w);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d EV AR %d %d %d %d\n", w, v, w, v, w);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d EV RM %d %d %d\n", v, v, w, v);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d EV UR %d %d %d\n", v, w, v, w);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d EV TR %d %d %d\n", w, v, v, v);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d EV EN %d %d\n", v, w, v);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d PC %d\n", w, v);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d CL cliente%d\n", v, i);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d MA %d %d %d\n", w, v, w, v);
+        linhas += texto;
+        snprintf(texto, sizeof(texto), "%d RC %d\n", v, v < 0 ? 0 : v);
+        linhas += texto;
+    }
+    // Campos faltando: viram consultas incompletas, nos dois caminhos
+    linhas += "0000001 PC\n0000002 CL\n0000003 MA 1 2\n0000004 RC -3\n0000005 RC\n";
+    // Eventos com só parte dos campos opcionais
+    linhas += "0000006 EV RG 7\n0000007 EV AR 7 1\n0000008 EV EN 7\n";
+    return linhas;
+}
+
+// Carga no formato do genwkl3: ciclos RG, AR, RM, TR, AR, RM, EN com
+// tempos crescentes e consultas intercaladas
+static string gerarCargaRealista() {
+    char texto[128];
+    string linhas;
+    int tempo = 0;
+    srand(7);
+    for (int etapa = 0; etapa < 7; etapa++) {
+        for (int p = 0; p < PACOTES; p++) {
+            tempo += rand() % 3;
+            int origem = p % ARMAZENS;
+            int destino = (p * 7 + 3) % ARMAZENS;
+            switch (etapa) {
+                case 0:
+                    snprintf(texto, sizeof(texto), "%07d EV RG %03d C%05d C%05d %03d %03d\n", tempo, p,
+                             rand() % 2000, rand() % 2000, origem, destino);
+                    break;
+                case 1: snprintf(texto, sizeof(texto), "%07d EV AR %03d %03d %03d %03d\n", tempo, p, origem, destino, 1); break;
+                case 2: snprintf(texto, sizeof(texto), "%07d EV RM %03d %03d %03d\n", tempo, p, origem, destino); break;
+                case 3: snprintf(texto, sizeof(texto), "%07d EV TR %03d %03d %03d\n", tempo, p, origem, destino); break;
+                case 4: snprintf(texto, sizeof(texto), "%07d EV AR %03d %03d %03d %03d\n", tempo, p, destino, destino, 2); break;
+                case 5: snprintf(texto, sizeof(texto), "%07d EV RM %03d %03d %03d\n", tempo, p, destino, destino); break;
+                default: snprintf(texto, sizeof(texto), "%07d EV EN %03d %03d\n", tempo, p, destino); break;
+            }
+            linhas += texto;
+            if (p % 97 == 0) {
+                switch ((p / 97) % 4) {
+                    case 0: snprintf(texto, sizeof(texto), "%07d PC %03d\n", tempo, rand() % (p + 1)); break;
+                    case 1: snprintf(texto, sizeof(texto), "%07d CL C%05d\n", tempo, rand() % 2000); break;
+                    case 2: snprintf(texto, sizeof(texto), "%07d MA %07d %07d %03d\n", tempo, tempo / 2, tempo, origem); break;
+                    default: snprintf(texto, sizeof(texto), "%07d RC %d\n", tempo, 5); break;
+                }
+                linhas += texto;
+            }
+        }
+    }
+    return linhas;
+}
+
+// Respostas do Simulador para um arquivo (texto ou log)
+static string simular(const string& arquivo) {
+    string saida = arquivoTemporario(".out");
+    int fd = open(saida.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    {
+        Simulador simulador(fd);
+        simulador.carregarEventos(arquivo);
+        simulador.descarregarSaida();
+    }
+    close(fd);
+    string conteudo = lerArquivo(saida);
+    unlink(saida.c_str());
+    return conteudo;
+}
+
+int main() {
+    testarRoundTrip(gerarCasosLimite(), "casos limite");
+
+    string carga = gerarCargaRealista();
+    ResumoConversao resumo = testarRoundTrip(carga, "carga realista");
+    double razao = static_cast<double>(resumo.bytesEntrada) / resumo.bytesSaida;
+    printf("carga realista: %zu -> %zu bytes (%.2fx)\n", resumo.bytesEntrada, resumo.bytesSaida, razao);
+    VERIFICAR(razao >= RAZAO_MINIMA, "razao de tamanho da carga realista");
+
+    string entrada = arquivoTemporario(".in");
+    string log = arquivoTemporario(".bin");
+    gravarArquivo(entrada, carga);
+    converterParaLogBinario(entrada, log);
+    string respostasTexto = simular(entrada);
+    VERIFICAR(!respostasTexto.empty(), "respostas do texto");
+    VERIFICAR(respostasTexto == simular(log), "respostas do Simulador, texto contra log");
+    unlink(entrada.c_str());
+    unlink(log.c_str());
+
+    if (falhas) {
+        fprintf(stderr, "%d verificacoes falharam\n", falhas);
+        return 1;
+    }
+    printf("TesteLogBinario: ok\n");
+    return 0;
+}